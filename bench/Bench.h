@@ -0,0 +1,74 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "GameOptions.h"
+
+/**
+ * @brief Shape of a generated board file (see writeBoardFile).
+ */
+struct BoardSpec {
+    size_t rows = 64;
+    size_t cols = 64;
+    int maxSteps = 200;
+    int numShells = 16;
+    int wallPercent = 10;     ///< Share of cells holding a wall
+    int minePercent = 1;      ///< Share of cells holding a mine
+    size_t tanksPerPlayer = 4;
+    uint32_t seed = 1;
+};
+
+/**
+ * @brief Value the benchmarks fold their results into, so the measured work is not optimized away.
+ */
+inline volatile uint64_t benchSink = 0;
+
+/**
+ * @brief Calls body() until at least minSeconds passed and returns the mean nanoseconds per call.
+ */
+template <typename Body>
+double nanosPerCall(Body&& body, double minSeconds = 0.3) {
+    using Clock = std::chrono::steady_clock;
+    body(); // warm-up
+    size_t calls = 0;
+    auto start = Clock::now();
+    std::chrono::duration<double> elapsed{0};
+    do {
+        body();
+        ++calls;
+        elapsed = Clock::now() - start;
+    } while (elapsed.count() < minSeconds);
+    return elapsed.count() * 1e9 / static_cast<double>(calls);
+}
+
+/**
+ * @brief Prints one result line: benchmark, case, value and unit, aligned in columns.
+ */
+void report(const std::string& bench, const std::string& name, double value, const std::string& unit);
+
+/**
+ * @brief Writes a random board with the given shape in the working directory.
+ * @return The file name.
+ */
+std::string writeBoardFile(const std::string& name, const BoardSpec& spec);
+
+/**
+ * @brief Plays a whole game on a board file with the built-in players.
+ * @return Mean nanoseconds per turn played.
+ */
+double nanosPerTurn(const std::string& boardFile, const GameOptions& options = {});
+
+// One entry point per benchmark, run by name from main (see bench/main.cpp)
+
+/** @brief Board and cell storage: cell access patterns and turns on large boards. */
+void benchBoard();
+
+/** @brief Collision passes with many entities, and shell spawn/release churn. */
+void benchCollisions();
+
+/** @brief Turn time of a large board with a fixed stripe count on 1 to N threads. */
+void benchStripes();
+
+/** @brief Cost of one decision: a virtual getAction next to a strategy coroutine resume. */
+void benchStrategy();
@@ -0,0 +1,124 @@
+#include "Bench.h"
+#include "Board.h"
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief A cell as the board stored it before the flat layout: its own coordinates,
+ *        the terrain and the wall hit counter, 16 bytes in all.
+ */
+struct LegacyCell {
+    int x;
+    int y;
+    TerrainType terrain = TerrainType::Empty;
+    int wallHits = 0;
+};
+
+/**
+ * @brief The board before the flat layout: one heap-allocated vector per row and two
+ *        modulos per wrapped access. Kept here as the reference the benchmark compares to.
+ */
+class LegacyBoard {
+private:
+    int rows;
+    int cols;
+    std::vector<std::vector<LegacyCell>> grid;
+
+public:
+    LegacyBoard(int rows, int cols) : rows(rows), cols(cols), grid(rows) {
+        for (int y = 0; y < rows; ++y) {
+            grid[y].reserve(cols);
+            for (int x = 0; x < cols; ++x) grid[y].push_back(LegacyCell{x, y});
+        }
+    }
+
+    LegacyCell& getCell(int x, int y) {
+        y = (y + rows) % rows;
+        x = (x + cols) % cols;
+        return grid[y][x];
+    }
+};
+
+/**
+ * @brief Positions a tank or shell could step to: random cells, one step past an edge at times.
+ */
+std::vector<std::pair<int, int>> randomSteps(int rows, int cols, size_t count) {
+    std::mt19937 random(7);
+    std::vector<std::pair<int, int>> steps(count);
+    for (auto& [x, y] : steps) {
+        x = static_cast<int>(random() % (cols + 2)) - 1;
+        y = static_cast<int>(random() % (rows + 2)) - 1;
+    }
+    return steps;
+}
+
+/**
+ * @brief Compares both layouts on random wrapped reads and on full row-major scans.
+ */
+void compareLayouts(int side) {
+    std::string size = std::to_string(side) + "x" + std::to_string(side);
+    Board board(side, side);
+    LegacyBoard legacy(side, side);
+    std::mt19937 random(3);
+    for (int y = 0; y < side; ++y) {
+        for (int x = 0; x < side; ++x) {
+            TerrainType terrain = random() % 10 == 0 ? TerrainType::Wall : TerrainType::Empty;
+            board.getCell(x, y).setTerrain(terrain);
+            legacy.getCell(x, y).terrain = terrain;
+        }
+    }
+
+    auto steps = randomSteps(side, side, 1 << 16);
+    double flatRead = nanosPerCall([&] {
+        uint64_t walls = 0;
+        for (auto [x, y] : steps) walls += board.getCell(x, y).getTerrain() == TerrainType::Wall;
+        benchSink = benchSink + walls;
+    }) / static_cast<double>(steps.size());
+    double legacyRead = nanosPerCall([&] {
+        uint64_t walls = 0;
+        for (auto [x, y] : steps) walls += legacy.getCell(x, y).terrain == TerrainType::Wall;
+        benchSink = benchSink + walls;
+    }) / static_cast<double>(steps.size());
+    report("board", size + " random getCell, nested rows", legacyRead, "ns/read");
+    report("board", size + " random getCell, flat bytes", flatRead, "ns/read");
+
+    double cells = static_cast<double>(side) * side;
+    double flatScan = nanosPerCall([&] {
+        uint64_t walls = 0;
+        for (size_t i = 0; i < board.getCellCount(); ++i) walls += board.getCellAt(i).getTerrain() == TerrainType::Wall;
+        benchSink = benchSink + walls;
+    }) / cells;
+    double legacyScan = nanosPerCall([&] {
+        uint64_t walls = 0;
+        for (int y = 0; y < side; ++y) {
+            for (int x = 0; x < side; ++x) walls += legacy.getCell(x, y).terrain == TerrainType::Wall;
+        }
+        benchSink = benchSink + walls;
+    }) / cells;
+    report("board", size + " full scan, nested rows", legacyScan, "ns/cell");
+    report("board", size + " full scan, flat bytes", flatScan, "ns/cell");
+}
+
+} // namespace
+
+/**
+ * @brief Cell access on both layouts, then whole turns of the engine on large boards.
+ */
+void benchBoard() {
+    compareLayouts(512);
+    compareLayouts(2048);
+
+    for (size_t side : {128, 512}) {
+        BoardSpec spec;
+        spec.rows = side;
+        spec.cols = side;
+        spec.maxSteps = 40;
+        spec.tanksPerPlayer = 8;
+        std::string name = "board_" + std::to_string(side) + ".txt";
+        double perTurn = nanosPerTurn(writeBoardFile(name, spec));
+        report("board", std::to_string(side) + "x" + std::to_string(side) + " game, 16 tanks", perTurn / 1000, "us/turn");
+    }
+}
@@ -0,0 +1,193 @@
+#include "Bench.h"
+#include "BitBoard.h"
+#include "OccupancyGrid.h"
+#include "ShellPool.h"
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr int SIDE = 1024;            ///< Board side of the collision scenario
+constexpr size_t TANK_COUNT = 20000;  ///< Tanks scattered over the board
+constexpr size_t SHELL_COUNT = 60000; ///< Shells scattered over the board
+
+/**
+ * @brief An entity as the engine dispatched on it before the type tag: a virtual getType()
+ *        building a string, and dynamic_cast for shells.
+ */
+class LegacyEntity {
+public:
+    virtual ~LegacyEntity() = default;
+    virtual std::string getType() const = 0;
+    std::pair<int, int> position;
+};
+
+class LegacyTank : public LegacyEntity {
+public:
+    std::string getType() const override { return "Tank"; }
+};
+
+class LegacyShell : public LegacyEntity {
+public:
+    std::string getType() const override { return "Shell"; }
+};
+
+/**
+ * @brief Random cells for the tanks and shells, plus walls on about one cell in twenty.
+ */
+struct Scenario {
+    std::vector<size_t> tankCells;
+    std::vector<size_t> shellCells;
+    std::vector<uint8_t> walls;
+
+    Scenario() : walls(static_cast<size_t>(SIDE) * SIDE, 0) {
+        std::mt19937 random(11);
+        for (uint8_t& wall : walls) wall = random() % 20 == 0;
+        for (size_t i = 0; i < TANK_COUNT; ++i) tankCells.push_back(random() % walls.size());
+        for (size_t i = 0; i < SHELL_COUNT; ++i) shellCells.push_back(random() % walls.size());
+    }
+};
+
+/**
+ * @brief One collision pass of the former engine: rebuild the position map, then split each
+ *        cell's entities by comparing type strings and collect the removals in sets.
+ */
+size_t legacyPass(const std::vector<std::unique_ptr<LegacyEntity>>& entities, const std::vector<uint8_t>& walls) {
+    std::map<std::pair<int, int>, std::vector<LegacyEntity*>> positionMap;
+    for (const auto& entity : entities) positionMap[entity->position].push_back(entity.get());
+
+    std::set<LegacyEntity*> tanksToRemove;
+    std::set<LegacyEntity*> shellsToRemove;
+    for (auto& [pos, occupants] : positionMap) {
+        std::vector<LegacyEntity*> tanks;
+        std::vector<LegacyEntity*> shells;
+        for (LegacyEntity* entity : occupants) {
+            if (entity->getType() == "Tank") tanks.push_back(entity);
+            else if (entity->getType() == "Shell") shells.push_back(entity);
+        }
+        bool wall = walls[static_cast<size_t>(pos.second) * SIDE + pos.first];
+        if ((!shells.empty() && !tanks.empty()) || tanks.size() > 1) tanksToRemove.insert(tanks.begin(), tanks.end());
+        if (wall || (!shells.empty() && !tanks.empty()) || shells.size() > 1) {
+            shellsToRemove.insert(shells.begin(), shells.end());
+        }
+        for (LegacyEntity* entity : occupants) {
+            if (dynamic_cast<LegacyShell*>(entity)) benchSink = benchSink + 1;
+        }
+    }
+    return tanksToRemove.size() + shellsToRemove.size();
+}
+
+/**
+ * @brief Compares a full collision pass of the former engine with the bit-plane sweep
+ *        and type-tag dispatch, every occupied cell being swept in both.
+ */
+void compareCollisionPasses() {
+    Scenario scenario;
+    std::string name = std::to_string(TANK_COUNT) + " tanks + " + std::to_string(SHELL_COUNT) + " shells";
+
+    std::vector<std::unique_ptr<LegacyEntity>> entities;
+    for (size_t cell : scenario.tankCells) {
+        entities.push_back(std::make_unique<LegacyTank>());
+        entities.back()->position = {static_cast<int>(cell % SIDE), static_cast<int>(cell / SIDE)};
+    }
+    for (size_t cell : scenario.shellCells) {
+        entities.push_back(std::make_unique<LegacyShell>());
+        entities.back()->position = {static_cast<int>(cell % SIDE), static_cast<int>(cell / SIDE)};
+    }
+    double legacy = nanosPerCall([&] { benchSink = benchSink + legacyPass(entities, scenario.walls); });
+    report("collisions", name + ", strings + map", legacy / 1000, "us/pass");
+
+    OccupancyGrid occupancy;
+    BitBoard bitboard;
+    size_t cells = scenario.walls.size();
+    occupancy.reset(cells);
+    bitboard.reset(cells);
+    occupancy.reserve(TANK_COUNT, SHELL_COUNT);
+    for (size_t cell = 0; cell < cells; ++cell) {
+        bitboard.setTerrain(cell, scenario.walls[cell] ? TerrainType::Wall : TerrainType::Empty);
+    }
+    for (size_t i = 0; i < TANK_COUNT; ++i) occupancy.insert(EntityType::Tank, static_cast<uint32_t>(i), scenario.tankCells[i]);
+    for (size_t i = 0; i < SHELL_COUNT; ++i) occupancy.insert(EntityType::Shell, static_cast<uint32_t>(i), scenario.shellCells[i]);
+
+    std::vector<size_t> tanksHit;
+    std::vector<uint32_t> shellsHit;
+    tanksHit.reserve(TANK_COUNT);
+    shellsHit.reserve(SHELL_COUNT);
+    double tagged = nanosPerCall([&] {
+        bitboard.clearTanks();
+        bitboard.clearShells();
+        for (size_t cell : scenario.tankCells) bitboard.addTank(cell);
+        for (size_t cell : scenario.shellCells) bitboard.addShell(cell);
+        for (size_t cell : occupancy.getChangedCells()) bitboard.markDirty(cell);
+
+        tanksHit.clear();
+        shellsHit.clear();
+        bitboard.forEachCollisionIn(0, SIZE_MAX, [&](size_t index, uint8_t flags) {
+            if (flags & LoneShell) return;
+            occupancy.forEachAt(index, [&](Occupant occupant) {
+                if (occupant.type == EntityType::Tank) {
+                    if (flags & TanksHit) tanksHit.push_back(occupant.index);
+                } else {
+                    shellsHit.push_back(occupant.index);
+                }
+                return false;
+            });
+        });
+        bitboard.clearDirty();
+        benchSink = benchSink + tanksHit.size() + shellsHit.size();
+    });
+    report("collisions", name + ", bit planes + tags", tagged / 1000, "us/pass");
+}
+
+/**
+ * @brief Fires and removes shells in random order: the former list of heap-allocated shells
+ *        erased by value, next to the ShellPool's recycled handles and swap-and-pop.
+ */
+void compareShellChurn() {
+    constexpr size_t LIVE = 4096;  ///< Shells in flight while churning
+    constexpr size_t ROUNDS = 4096; ///< Spawn/release pairs per measured call
+    std::mt19937 random(5);
+    std::vector<size_t> victims(ROUNDS);
+    for (size_t& victim : victims) victim = random() % LIVE;
+
+    std::vector<std::unique_ptr<LegacyShell>> legacy;
+    for (size_t i = 0; i < LIVE; ++i) legacy.push_back(std::make_unique<LegacyShell>());
+    double legacyChurn = nanosPerCall([&] {
+        for (size_t victim : victims) {
+            LegacyShell* gone = legacy[victim].get();
+            legacy.erase(std::remove_if(legacy.begin(), legacy.end(), [&](const auto& shell) { return shell.get() == gone; }),
+                         legacy.end());
+            legacy.push_back(std::make_unique<LegacyShell>());
+        }
+    }) / ROUNDS;
+    report("collisions", std::to_string(LIVE) + " shells churn, unique_ptr list", legacyChurn, "ns/op");
+
+    std::pmr::unsynchronized_pool_resource arena;
+    ShellPool pool(&arena);
+    pool.reserve(LIVE + 1);
+    for (size_t i = 0; i < LIVE; ++i) pool.spawn(static_cast<int>(i), 0, Direction::R);
+    double poolChurn = nanosPerCall([&] {
+        for (size_t victim : victims) {
+            pool.release(pool.getHandleAt(victim));
+            pool.spawn(static_cast<int>(victim), 1, Direction::L);
+        }
+    }) / ROUNDS;
+    report("collisions", std::to_string(LIVE) + " shells churn, ShellPool", poolChurn, "ns/op");
+}
+
+} // namespace
+
+/**
+ * @brief Collision passes with many entities, then shell spawn/release churn.
+ */
+void benchCollisions() {
+    compareCollisionPasses();
+    compareShellChurn();
+}
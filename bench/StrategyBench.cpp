@@ -0,0 +1,69 @@
+#include "Bench.h"
+#include "TankAlgorithm.h"
+#include "TankStrategy.h"
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace {
+
+constexpr size_t ALGORITHM_COUNT = 64; ///< Algorithms asked in turn, as the game asks its tanks
+
+/**
+ * @brief The same trivial decisions as cyclingStrategy, kept in a member between calls.
+ */
+class CyclingAlgorithm final : public TankAlgorithm {
+private:
+    unsigned turn = 0;
+
+public:
+    ActionRequest getAction() override {
+        unsigned phase = turn++ % 4;
+        return phase == 3 ? ActionRequest::GetBattleInfo : static_cast<ActionRequest>(phase);
+    }
+    void updateBattleInfo(BattleInfo&) override {}
+};
+
+/**
+ * @brief Three moves and a battle info request, over and over: just enough work that the
+ *        benchmark measures the cost of getting back into the decision logic.
+ */
+TankStrategy cyclingStrategy(std::allocator_arg_t, std::pmr::memory_resource*) {
+    for (unsigned turn = 0;; ++turn) {
+        unsigned phase = turn % 4;
+        if (phase == 3) {
+            co_await BattleInfoUpdate{};
+        } else {
+            co_yield static_cast<ActionRequest>(phase);
+        }
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Times one decision through a virtual getAction next to one resume of a strategy
+ *        coroutine, with the frames from the heap and from a pool shared by all of them.
+ */
+void benchStrategy() {
+    std::vector<std::unique_ptr<TankAlgorithm>> algorithms;
+    for (size_t i = 0; i < ALGORITHM_COUNT; ++i) algorithms.push_back(std::make_unique<CyclingAlgorithm>());
+    double virtualCall = nanosPerCall([&] {
+        unsigned sum = 0;
+        for (auto& algorithm : algorithms) sum += static_cast<unsigned>(algorithm->getAction());
+        benchSink = benchSink + sum;
+    }) / ALGORITHM_COUNT;
+    report("strategy", "virtual getAction", virtualCall, "ns/call");
+
+    std::pmr::unsynchronized_pool_resource pool;
+    for (std::pmr::memory_resource* frames : {std::pmr::get_default_resource(), static_cast<std::pmr::memory_resource*>(&pool)}) {
+        std::vector<TankStrategy> strategies;
+        for (size_t i = 0; i < ALGORITHM_COUNT; ++i) strategies.push_back(cyclingStrategy(std::allocator_arg, frames));
+        double resume = nanosPerCall([&] {
+            unsigned sum = 0;
+            for (TankStrategy& strategy : strategies) sum += static_cast<unsigned>(strategy.next());
+            benchSink = benchSink + sum;
+        }) / ALGORITHM_COUNT;
+        report("strategy", frames == &pool ? "coroutine resume, pooled frames" : "coroutine resume, heap frames", resume, "ns/call");
+    }
+}
@@ -0,0 +1,54 @@
+#include "Bench.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief Returns the content of a game's output file.
+ */
+std::string readOutput(const std::string& boardFile) {
+    std::ifstream output("output_" + boardFile);
+    std::stringstream content;
+    content << output.rdbuf();
+    return content.str();
+}
+
+} // namespace
+
+/**
+ * @brief Plays the same large, shell-heavy board serially, then with a fixed number of
+ *        stripes on a growing number of threads. The stripes stay the same, so only the
+ *        threads sharing them change between runs.
+ */
+void benchStripes() {
+    size_t maxThreads = std::max<size_t>(4, std::thread::hardware_concurrency());
+    BoardSpec spec;
+    spec.rows = 256;
+    spec.cols = 256;
+    spec.maxSteps = 40;
+    spec.numShells = 40;
+    spec.wallPercent = 2;
+    spec.tanksPerPlayer = 32;
+    std::string board = writeBoardFile("stripes_256.txt", spec);
+
+    double serial = nanosPerTurn(board);
+    std::string expected = readOutput(board);
+    report("stripes", "256x256 game, 64 tanks, serial", serial / 1000, "us/turn");
+
+    for (size_t threads = 1; threads <= maxThreads; ++threads) {
+        GameOptions options;
+        options.decisionThreads = threads;
+        options.shellStripes = maxThreads;
+        double perTurn = nanosPerTurn(board, options);
+        std::string name = std::to_string(maxThreads) + " stripes, " + std::to_string(threads) + " threads";
+        report("stripes", name, perTurn / 1000, "us/turn");
+        if (readOutput(board) != expected) {
+            std::cerr << "stripes: output with " << name << " differs from the serial run\n";
+        }
+    }
+}
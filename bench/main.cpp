@@ -0,0 +1,98 @@
+#include "Bench.h"
+#include "GameManager.h"
+#include "MyPlayerFactory.h"
+#include "MyTankAlgorithmFactory.h"
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Prints one result line.
+ */
+void report(const std::string& bench, const std::string& name, double value, const std::string& unit) {
+    std::cout << std::left << std::setw(12) << bench << std::setw(44) << name
+              << std::right << std::fixed << std::setprecision(1) << std::setw(14) << value << ' ' << unit << std::endl;
+}
+
+/**
+ * @brief Scatters walls, mines and each player's tanks over empty cells with a fixed seed.
+ */
+std::string writeBoardFile(const std::string& name, const BoardSpec& spec) {
+    std::mt19937 random(spec.seed);
+    std::vector<std::string> map(spec.rows, std::string(spec.cols, ' '));
+    for (std::string& row : map) {
+        for (char& c : row) {
+            int roll = static_cast<int>(random() % 100);
+            if (roll < spec.wallPercent) c = '#';
+            else if (roll < spec.wallPercent + spec.minePercent) c = '@';
+        }
+    }
+    for (char player : {'1', '2'}) {
+        for (size_t placed = 0; placed < spec.tanksPerPlayer;) {
+            char& c = map[random() % spec.rows][random() % spec.cols];
+            if (c != ' ') continue;
+            c = player;
+            ++placed;
+        }
+    }
+
+    std::ofstream file(name);
+    file << "Benchmark board\n"
+         << "MaxSteps = " << spec.maxSteps << "\n"
+         << "NumShells = " << spec.numShells << "\n"
+         << "Rows = " << spec.rows << "\n"
+         << "Cols = " << spec.cols << "\n";
+    for (const std::string& row : map) file << row << "\n";
+    return name;
+}
+
+/**
+ * @brief Times readBoard plus run, then counts the turns in the output file (one line per
+ *        turn plus the result line).
+ */
+double nanosPerTurn(const std::string& boardFile, const GameOptions& options) {
+    auto start = std::chrono::steady_clock::now();
+    {
+        GameManager game(std::make_unique<MyPlayerFactory>(), std::make_unique<MyTankAlgorithmFactory>(), options);
+        if (!game.readBoard(boardFile)) return 0;
+        game.run();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::ifstream output("output_" + boardFile);
+    size_t lines = 0;
+    for (std::string line; std::getline(output, line);) ++lines;
+    size_t turns = lines > 1 ? lines - 1 : 1;
+    return elapsed.count() * 1e9 / static_cast<double>(turns);
+}
+
+/**
+ * @brief Runs the benchmarks named on the command line (all of them by default) in a
+ *        scratch directory, since games write their output files to the working directory.
+ */
+int main(int argc, char* argv[]) {
+    struct Entry {
+        const char* name;
+        void (*run)();
+    };
+    const Entry benches[] = {
+        {"board", benchBoard},
+        {"collisions", benchCollisions},
+        {"stripes", benchStripes},
+        {"strategy", benchStrategy},
+    };
+
+    std::filesystem::path scratch = std::filesystem::temp_directory_path() / "tanks_bench";
+    std::filesystem::create_directories(scratch);
+    std::filesystem::current_path(scratch);
+
+    for (const Entry& bench : benches) {
+        bool selected = argc == 1;
+        for (int i = 1; i < argc; ++i) selected = selected || bench.name == std::string(argv[i]);
+        if (selected) bench.run();
+    }
+    return 0;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <string>
+#include <cstdint>
+#include <ostream>
 #include "ActionRequest.h" 
 
 /**
@@ -10,9 +11,9 @@
  * It is useful for debugging, logging, and textual output.
  * 
  * @param action The ActionRequest value to convert.
- * @return std::string A string representation of the given action.
+ * @return A string representation of the given action (static storage, never allocates).
  */
-inline std::string toString(ActionRequest action) {
+inline const char* toString(ActionRequest action) {
     switch (action) {
         case ActionRequest::MoveForward:     return "MoveForward";
         case ActionRequest::MoveBackward:    return "MoveBackward";
@@ -26,3 +27,29 @@ inline std::string toString(ActionRequest action) {
         default:                             return "Unknown";
     }
 }
+
+/**
+ * @struct TurnAction
+ * @brief One tank's entry in a turn's output line, kept as the requested action plus
+ *        outcome flags and only turned into text when the line is written.
+ */
+struct TurnAction {
+    static constexpr uint8_t Ignored = 1 << 0; ///< The action could not be performed
+    static constexpr uint8_t Killed  = 1 << 1; ///< The tank was destroyed during the turn
+    static constexpr uint8_t Dead    = 1 << 2; ///< The tank was already dead when the turn started
+
+    ActionRequest action = ActionRequest::DoNothing; ///< Action requested by the tank's algorithm
+    uint8_t flags = Dead;                            ///< Combination of the flags above
+};
+
+/**
+ * @brief Writes a turn action the way it appears in the output file,
+ *        e.g. "Shoot (ignored)", "MoveForward (killed)" or "killed".
+ */
+inline std::ostream& operator<<(std::ostream& os, const TurnAction& entry) {
+    if (entry.flags & TurnAction::Dead) return os << "killed";
+    os << toString(entry.action);
+    if (entry.flags & TurnAction::Ignored) os << " (ignored)";
+    if (entry.flags & TurnAction::Killed) os << " (killed)";
+    return os;
+}
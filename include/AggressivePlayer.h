@@ -12,25 +12,17 @@
  * This class tracks known enemy tank positions and attempts to assign each tank
  * a unique enemy to pursue using satellite view information.
  */
-class AggressivePlayer : public MyPlayer {
+class AggressivePlayer final : public MyPlayer {
 private:
     std::set<std::pair<int, int>> assignedEnemies; ///< Positions already assigned to other tanks
     std::set<std::pair<int, int>> knownEnemies;    ///< Enemy tank positions discovered via satellite view
 
     /**
-     * @brief Updates known enemy positions based on the given grid.
+     * @brief Updates known enemy positions from the ones found in the satellite scan.
      * 
-     * @param grid A 2D grid of ObjectTypes representing satellite scan.
+     * @param enemyTanks Enemy tank positions listed by MyBattleInfo.
      */
-    void updateKnownEnemies(const std::vector<std::vector<ObjectType>>& grid);
-
-    /**
-     * @brief Finds the calling tank's position on the board.
-     * 
-     * @param satellite_view Satellite view of the board.
-     * @return The position (x, y) of the current tank.
-     */
-    std::pair<int, int> findMyPosition(SatelliteView& satellite_view) const;
+    void updateKnownEnemies(const std::vector<std::pair<int, int>>& enemyTanks);
 
     /**
      * @brief Selects the closest enemy tank not yet assigned to another tank.
@@ -63,4 +55,22 @@ public:
      * @param satellite_view The satellite view of the board.
      */
     void updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satellite_view) override;
+
+    /**
+     * @brief Same as updateTankWithBattleInfo, typed on the concrete algorithm and view so the
+     *        calls into them are direct (instantiated for TankAlgorithm with SatelliteView, and
+     *        for ChasingTankAlgorithm with MySatelliteView).
+     */
+    template <typename Algorithm, typename View>
+    void updateTank(Algorithm& tank, const View& satellite_view);
+
+    /**
+     * @brief Hashes the known and the already assigned enemy positions.
+     */
+    uint64_t stateHash() const override;
+
+    /**
+     * @brief Appends the known and the already assigned enemy positions.
+     */
+    void appendState(std::vector<uint64_t>& out) const override;
 };
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstddef>
+
+/**
+ * @class AllocationGuard
+ * @brief Counts the heap allocations made by every thread (test builds only).
+ *
+ * When built with -DTANKS_ALLOC_GUARD, the global operator new is replaced by one that
+ * counts every allocation in a process-wide counter, so the worker threads of the
+ * parallel phases are counted too. A Pause stops counting only on the thread that holds
+ * it. The game manager uses it to check that warmed-up turns do not allocate. Without
+ * the flag, every method is an inline no-op.
+ */
+class AllocationGuard {
+public:
+#ifdef TANKS_ALLOC_GUARD
+    /**
+     * @brief Returns the number of counted allocations made by all threads so far.
+     */
+    static size_t getCount();
+
+    /**
+     * @class Pause
+     * @brief Stops counting on the calling thread for its lifetime (e.g. around algorithm code).
+     */
+    class Pause {
+    public:
+        Pause();
+        ~Pause();
+        Pause(const Pause&) = delete;
+        Pause& operator=(const Pause&) = delete;
+    };
+#else
+    static size_t getCount() { return 0; }
+
+    class Pause {
+    public:
+        Pause() {}
+        ~Pause() {}
+        Pause(const Pause&) = delete;
+        Pause& operator=(const Pause&) = delete;
+    };
+#endif
+};
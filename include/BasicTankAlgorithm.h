@@ -13,7 +13,7 @@
  * This algorithm is designed to provide a balanced behavior — defensive at first, aggressive if needed.
  * It inherits from MyTankAlgorithm and leverages grid knowledge to choose safe and meaningful actions.
  */
-class BasicTankAlgorithm : public MyTankAlgorithm {
+class BasicTankAlgorithm final : public MyTankAlgorithm {
 private:
     /**
      * @brief Determines an action to take when no immediate danger exists.
@@ -45,7 +45,8 @@ private:
     /**
     * @brief Scans in all 8 directions up to a given radius to find visible enemy tank.
     *
-    * Returns the (dx, dy) direction to the enemy if seen with no walls in the way.
+    * Returns the (dx, dy) direction to the enemy if seen with no walls in the way (a cell
+    * outside the view window blocks the line too).
     * If not found, returns (2, 2) as a sentinel value.
     */
     std::pair<int, int> findVisibleEnemyDirectionInRadius(int radius);
@@ -0,0 +1,163 @@
+#pragma once
+#include <vector>
+#include <memory_resource>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include "Cell.h"
+
+/**
+ * @brief What a collision sweep found on a cell (bit flags, see BitBoard::forEachCollision).
+ */
+enum CollisionFlag : uint8_t {
+    TanksHit  = 1 << 0, ///< The tanks on the cell are destroyed
+    OnMine    = 1 << 1, ///< A tank stepped on the mine of the cell
+    OnWall    = 1 << 2, ///< The wall of the cell was hit
+    LoneShell = 1 << 3  ///< A single shell on an otherwise clear cell (only a head-on hit can remove it)
+};
+
+/**
+ * @class BitBoard
+ * @brief Bit-plane view of the board, kept next to Board and OccupancyGrid.
+ *
+ * Every plane holds one bit per cell in the board's row-major order, packed into 64-bit
+ * words. Terrain planes (walls, mines) are kept in sync as terrain changes. The tank planes
+ * are built once per turn, since tanks stand still while shells fly, and lose the cells
+ * whose tanks are destroyed. The shell planes are rebuilt on every shell half-step.
+ * Collision questions are then answered for 64 cells at a time with word-wide AND/OR,
+ * and only the words holding cells entered since the last pass are swept.
+ *
+ * Every shell on a visited cell is destroyed, except a lone shell that was not hit
+ * head-on, so the sweep reports no separate flag for shells.
+ */
+class BitBoard {
+private:
+    std::pmr::vector<uint64_t> walls;       ///< Cells holding a wall
+    std::pmr::vector<uint64_t> mines;       ///< Cells holding a mine
+    std::pmr::vector<uint64_t> tanks;       ///< Cells holding at least one tank
+    std::pmr::vector<uint64_t> shells;      ///< Cells holding at least one shell
+    std::pmr::vector<uint64_t> multiTanks;  ///< Cells holding more than one tank
+    std::pmr::vector<uint64_t> multiShells; ///< Cells holding more than one shell
+    std::pmr::vector<uint64_t> dirty;       ///< Cells entered since the last clearDirty()
+    std::pmr::vector<size_t> tankWords;     ///< Words written in the tank planes since clearTanks()
+    std::pmr::vector<size_t> shellWords;    ///< Words written in the shell planes since clearShells()
+    std::pmr::vector<size_t> dirtyWords;    ///< Words holding at least one dirty bit
+
+    /** @brief Sets the bit of a cell in a plane. */
+    static void set(std::pmr::vector<uint64_t>& plane, size_t cell) { plane[cell >> 6] |= uint64_t{1} << (cell & 63); }
+
+    /** @brief Clears the bit of a cell in a plane. */
+    static void reset(std::pmr::vector<uint64_t>& plane, size_t cell) { plane[cell >> 6] &= ~(uint64_t{1} << (cell & 63)); }
+
+    /** @brief Tests the bit of a cell in a plane. */
+    static bool test(const std::pmr::vector<uint64_t>& plane, size_t cell) { return (plane[cell >> 6] >> (cell & 63)) & 1u; }
+
+public:
+    /**
+     * @brief Constructs an empty bitboard whose arrays draw from the given memory resource.
+     */
+    explicit BitBoard(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Clears every plane and resizes them to the given number of cells.
+     */
+    void reset(size_t cellCount);
+
+    /**
+     * @brief Mirrors the terrain of a cell into the wall and mine planes.
+     */
+    void setTerrain(size_t cell, TerrainType terrain);
+
+    /**
+     * @brief Clears the tank planes (only the words written since the last clear are touched).
+     */
+    void clearTanks();
+
+    /**
+     * @brief Clears the shell planes (only the words written since the last clear are touched).
+     */
+    void clearShells();
+
+    /**
+     * @brief Records a tank on a cell; a second tank on the same cell sets its multi-tank bit.
+     */
+    void addTank(size_t cell) {
+        if (tanks[cell >> 6] == 0) tankWords.push_back(cell >> 6);
+        if (test(tanks, cell)) set(multiTanks, cell);
+        set(tanks, cell);
+    }
+
+    /**
+     * @brief Forgets the tanks of a cell (a collision always destroys every tank on it).
+     */
+    void removeTanks(size_t cell) {
+        reset(tanks, cell);
+        reset(multiTanks, cell);
+    }
+
+    /**
+     * @brief Records a shell on a cell; a second shell on the same cell sets its multi-shell bit.
+     */
+    void addShell(size_t cell) {
+        if (shells[cell >> 6] == 0) shellWords.push_back(cell >> 6);
+        if (test(shells, cell)) set(multiShells, cell);
+        set(shells, cell);
+    }
+
+    /**
+     * @brief Checks whether the entity planes hold a shell on the given cell.
+     */
+    bool hasShell(size_t cell) const { return test(shells, cell); }
+
+    /**
+     * @brief Returns the number of 64-cell words in each plane.
+     */
+    size_t getWordCount() const { return walls.size(); }
+
+    /**
+     * @brief Marks a cell to be swept by the next collision pass.
+     */
+    void markDirty(size_t cell);
+
+    /**
+     * @brief Forgets all dirty cells.
+     */
+    void clearDirty();
+
+    /**
+     * @brief Calls visit(cell, flags) for every dirty cell with a collision or a lone shell.
+     *        Collisions are independent per cell, so the visiting order does not matter.
+     */
+    template <typename Visitor>
+    void forEachCollision(Visitor&& visit) const {
+        forEachCollisionIn(0, SIZE_MAX, visit);
+    }
+
+    /**
+     * @brief Same as forEachCollision, limited to the dirty cells of words [firstWord, lastWord).
+     *        Only the terrain of the visited cell may be changed by visit, so disjoint word
+     *        ranges can be swept from different threads.
+     */
+    template <typename Visitor>
+    void forEachCollisionIn(size_t firstWord, size_t lastWord, Visitor&& visit) const {
+        for (size_t w : dirtyWords) {
+            if (w < firstWord || w >= lastWord) continue;
+            uint64_t occupied = tanks[w] | shells[w];
+            uint64_t onMine = tanks[w] & mines[w];
+            uint64_t onWall = walls[w] & occupied;
+            uint64_t tanksHit = onMine | (tanks[w] & (shells[w] | multiTanks[w]));
+            uint64_t loneShell = shells[w] & ~(tanks[w] | multiShells[w] | walls[w]);
+
+            // Shells meeting a tank are already in tanksHit; the other shell hits are walls and crowds
+            uint64_t pending = (tanksHit | onWall | multiShells[w] | loneShell) & dirty[w];
+            while (pending) {
+                int bit = std::countr_zero(pending);
+                pending &= pending - 1;
+                uint64_t mask = uint64_t{1} << bit;
+                uint8_t flags = ((tanksHit & mask) ? TanksHit : 0) | ((onMine & mask) ? OnMine : 0) |
+                                ((onWall & mask) ? OnWall : 0) | ((loneShell & mask) ? LoneShell : 0);
+                visit((w << 6) | static_cast<size_t>(bit), flags);
+            }
+        }
+    }
+};
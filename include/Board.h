@@ -1,28 +1,33 @@
 #pragma once
 #include <vector>
+#include <memory_resource>
 #include <memory>
+#include <utility>
+#include <cstddef>
 #include "Cell.h"
 
 /**
  * @class Board
- * @brief Represents the game board as a 2D grid of cells.
- * 
- * The Board stores a grid of Cell objects, each representing a tile on the game board.
- * It handles access to cells, wrapping logic, and checks for empty spaces.
+ * @brief Represents the game board as a flat, row-major grid of packed cells.
+ *
+ * The Board stores one contiguous array of Cell bytes, where the cell at (x, y)
+ * lives at index y * cols + x. It handles access to cells by coordinates or by index,
+ * wrapping logic, and checks for empty spaces.
  */
 class Board {
 private:
     size_t rows;  ///< Num of Rows of the board
     size_t cols;  ///< Num of cols of the board
-    std::vector<std::vector<Cell>> grid; ///< 2D grid of Cell objects
+    std::pmr::vector<Cell> cells; ///< Row-major packed cells (index = y * cols + x)
 
 public:
     /**
      * @brief Constructs a board with given dimensions.
      * @param cols Number of columns
      * @param rows Number of rows
+     * @param resource Memory resource the cells are allocated from
      */
-    Board(size_t rows, size_t cols);
+    Board(size_t rows, size_t cols, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     // Prevent copying
     Board(const Board&) = delete;
@@ -37,6 +42,33 @@ public:
      */
     Cell& getCell(int x, int y);
 
+    /**
+     * @brief Returns the flat index of in-bounds coordinates (no wrapping is applied).
+     */
+    size_t toIndex(int x, int y) const { return static_cast<size_t>(y) * cols + static_cast<size_t>(x); }
+
+    /**
+     * @brief Returns the (x, y) coordinates of a flat cell index.
+     */
+    std::pair<int, int> toPosition(size_t index) const {
+        return {static_cast<int>(index % cols), static_cast<int>(index / cols)};
+    }
+
+    /**
+     * @brief Returns a const reference to the cell at a flat index.
+     */
+    const Cell& getCellAt(size_t index) const { return cells[index]; }
+
+    /**
+     * @brief Returns a mutable reference to the cell at a flat index.
+     */
+    Cell& getCellAt(size_t index) { return cells[index]; }
+
+    /**
+     * @brief Returns the total number of cells (rows * cols).
+     */
+    size_t getCellCount() const { return cells.size(); }
+
     /**
      * @brief Checks if a cell at (x, y) is empty (not a wall or mine).
      */
@@ -56,5 +88,9 @@ public:
      * @brief Wraps coordinates around board edges (torus-like behavior).
      *        Useful for supporting movement beyond edges.
      */
-    void wrapPosition(int& x, int& y) const;
+    void wrapPosition(int& x, int& y) const {
+        // In-bounds coordinates are by far the common case, skip the divisions for them
+        if (static_cast<size_t>(y) >= rows) y = static_cast<int>((y + rows) % rows);
+        if (static_cast<size_t>(x) >= cols) x = static_cast<int>((x + cols) % cols);
+    }
 };
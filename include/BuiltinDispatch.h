@@ -0,0 +1,67 @@
+#pragma once
+#include <typeinfo>
+#include <cstddef>
+#include "ActionRequest.h"
+#include "Player.h"
+#include "TankAlgorithm.h"
+#include "DefensivePlayer.h"
+#include "AggressivePlayer.h"
+#include "BasicTankAlgorithm.h"
+#include "ChasingTankAlgorithm.h"
+#include "MySatelliteView.h"
+
+/**
+ * @struct BuiltinDispatch
+ * @brief Direct (non-virtual) calls into the built-in players and tank algorithms.
+ *
+ * MyPlayerFactory and MyTankAlgorithmFactory give player 1 a DefensivePlayer with
+ * BasicTankAlgorithm tanks, and player 2 an AggressivePlayer with ChasingTankAlgorithm
+ * tanks. All of these are final, so once the concrete type is known every call below
+ * binds statically, and the satellite scan inlines MySatelliteView::getObjectAt instead
+ * of making a virtual call per cell. The game manager only takes this path when every
+ * player and algorithm of the game has exactly its built-in type (see matches); games
+ * built from other factories keep the virtual interfaces.
+ */
+struct BuiltinDispatch {
+    /**
+     * @brief Checks whether a player has the built-in type of its index.
+     */
+    static bool matches(const Player& player, int playerIndex) {
+        return playerIndex == 1 ? typeid(player) == typeid(DefensivePlayer)
+                                : typeid(player) == typeid(AggressivePlayer);
+    }
+
+    /**
+     * @brief Checks whether a tank algorithm has the built-in type of its player's index.
+     */
+    static bool matches(const TankAlgorithm& algorithm, int playerIndex) {
+        return playerIndex == 1 ? typeid(algorithm) == typeid(BasicTankAlgorithm)
+                                : typeid(algorithm) == typeid(ChasingTankAlgorithm);
+    }
+
+    /**
+     * @brief Asks a built-in tank algorithm for its action.
+     */
+    static ActionRequest getAction(TankAlgorithm& algorithm, int playerIndex) {
+        if (playerIndex == 1) return static_cast<BasicTankAlgorithm&>(algorithm).getAction();
+        return static_cast<ChasingTankAlgorithm&>(algorithm).getAction();
+    }
+
+    /**
+     * @brief Asks a built-in planning algorithm (player 2's) for its next actions.
+     */
+    static size_t planActions(TankAlgorithm& algorithm, ActionRequest* out, size_t maxActions) {
+        return static_cast<ChasingTankAlgorithm&>(algorithm).planActions(out, maxActions);
+    }
+
+    /**
+     * @brief Hands a satellite view to a built-in player for one of its tanks.
+     */
+    static void updateTank(Player& player, TankAlgorithm& algorithm, const MySatelliteView& view, int playerIndex) {
+        if (playerIndex == 1) {
+            static_cast<DefensivePlayer&>(player).updateTank(static_cast<BasicTankAlgorithm&>(algorithm), view);
+        } else {
+            static_cast<AggressivePlayer&>(player).updateTank(static_cast<ChasingTankAlgorithm&>(algorithm), view);
+        }
+    }
+};
@@ -1,16 +1,11 @@
 #pragma once
-#include <set>
-#include <utility>
-#include <string>
-
-class Tank;  // forward declaration
-class Shell; // forward declaration
+#include <cstdint>
 
 /**
  * @enum TerrainType
  * @brief Represents the type of terrain in a cell.
  */
-enum class TerrainType {
+enum class TerrainType : uint8_t {
     Empty,  ///< No obstacle
     Wall,   ///< A wall that can be hit and destroyed
     Mine    ///< A mine that explodes on tank entry
@@ -20,53 +15,54 @@ enum class TerrainType {
  * @class Cell
  * @brief Represents a single tile on the game board.
  *
- * Each cell stores its position, terrain type, and wall damage state.
+ * A cell is packed into a single byte: the low two bits hold the terrain type and
+ * the remaining bits hold the wall damage counter. The cell's coordinates are implied
+ * by its index in the board's row-major storage.
  */
 class Cell {
 private:
-    int x; ///< X coordinate of the cell
-    int y; ///< Y coordinate of the cell
-    TerrainType terrain; ///< Current terrain type of the cell
-    int wallHits; ///< Number of hits taken by wall
+    static constexpr uint8_t TERRAIN_MASK = 0x03; ///< Bits holding the terrain type
+    static constexpr uint8_t HITS_SHIFT = 2;      ///< First bit of the wall hit counter
 
-public:
-    /**
-     * @brief Constructs an empty cell at a given (x, y) position.
-     */
-    Cell(int x, int y);
+    uint8_t bits = 0; ///< Packed terrain type and wall hit counter
 
+public:
     /**
-     * @brief Returns the coordinates of the cell.
+     * @brief Constructs an empty cell with no wall damage.
      */
-    std::pair<int, int> getPoint() const;
+    Cell() = default;
 
     /**
      * @brief Gets the current terrain type of the cell.
      */
-    TerrainType getTerrain() const;
+    TerrainType getTerrain() const { return static_cast<TerrainType>(bits & TERRAIN_MASK); }
 
     /**
-     * @brief Sets the terrain type of the cell.
+     * @brief Sets the terrain type of the cell (wall damage is kept).
      */
-    void setTerrain(TerrainType t);
+    void setTerrain(TerrainType t) {
+        bits = static_cast<uint8_t>((bits & ~TERRAIN_MASK) | static_cast<uint8_t>(t));
+    }
 
     /**
-     * @brief Returns how many times a wall was hit (or -1 if not a wall).
+     * @brief Returns how many times the wall in this cell was hit.
      */
-    int getWallHits() const;
+    int getWallHits() const { return bits >> HITS_SHIFT; }
 
     /**
      * @brief Increments the wall hit counter.
      */
-    void incrementWallHits();
+    void incrementWallHits() { bits = static_cast<uint8_t>(bits + (1 << HITS_SHIFT)); }
 
     /**
      * @brief Resets the wall (turns it into empty cell and clears hits).
      */
-    void resetWall();
+    void resetWall() { bits = 0; }
 
     /**
      * @brief Resets a mine (turns terrain into empty).
      */
-    void resetMine();
+    void resetMine() { setTerrain(TerrainType::Empty); }
 };
+
+static_assert(sizeof(Cell) == 1, "Cell must stay packed into a single byte");
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "MyTankAlgorithm.h"
+#include "ActionPlanner.h"
+#include "TankStrategy.h"
 #include "MyBattleInfo.h"
 #include "Tank.h"
 #include "ActionRequest.h"
@@ -10,6 +12,9 @@
 #include <vector>
 #include <tuple>
 #include <map>
+#include <deque>
+#include <cstdint>
+#include <memory_resource>
 #include <utility>
 #include <cmath>
 #include <algorithm>
@@ -19,14 +24,16 @@
  * @brief Implements a tank algorithm that actively chases the enemy using BFS pathfinding.
  *        Combines reactive behavior (avoiding threats, shooting) with strategic planning.
  */
-class ChasingTankAlgorithm : public MyTankAlgorithm {
+class ChasingTankAlgorithm final : public MyTankAlgorithm, public ActionPlanner {
 public:
     /**
      * @brief Constructor.
      * @param playerIndex The index of the player (1 or 2).
      * @param tankIndex The index of the tank for this player.
+     * @param frames Resource the strategy's coroutine frame is allocated from (it must
+     *        outlive the algorithm); the game passes its arena.
      */
-    ChasingTankAlgorithm(int playerIndex, int tankIndex);
+    ChasingTankAlgorithm(int playerIndex, int tankIndex, std::pmr::memory_resource* frames = std::pmr::get_default_resource());
 
     /**
      * @brief Computes the next action for the tank on this turn.
@@ -41,9 +48,38 @@ public:
      */
     void updateBattleInfo(BattleInfo& info) override;
 
+    /**
+     * @brief Extends the base state hash with the cached path and the enemy positions.
+     * @return Hash of the algorithm's decision state (BFS scratch buffers excluded).
+     */
+    uint64_t stateHash() const override;
+
+    /**
+     * @brief Appends the base state, the enemy positions and the rest of the cached path.
+     */
+    void appendState(std::vector<uint64_t>& out) const override;
+
+    /**
+     * @brief Plans the coming turns until the tank asks for battle info.
+     *        Between two battle-info updates the tank only reasons about its own state,
+     *        so these are exactly the actions it would return one turn at a time. A turn
+     *        that would only take the next step of the cached path is planned straight from
+     *        the path; any other turn resumes the strategy.
+     * @param out Buffer receiving the plan.
+     * @param maxActions Capacity of out.
+     * @return Number of planned actions.
+     */
+    size_t planActions(ActionRequest* out, size_t maxActions) override;
+
 private:
     std::vector<ActionRequest> currentPath;                      ///< Cached path of actions to perform.
     std::vector<std::pair<int, int>> plannedPositions;           ///< Planned positions associated with currentPath.
+    size_t pathCursor = 0;                                       ///< Next step of currentPath (steps before it were taken).
+
+    /**
+     * @brief Checks whether steps of the current path remain to be taken.
+     */
+    bool hasPathAhead() const { return pathCursor < currentPath.size(); }
     std::pair<int, int> enemyPosition = { -1, -1 };              ///< Last known position of the enemy.
     std::pair<int, int> lastEnemyPosition = { -1, -1 };          ///< Previous known position of the enemy.
 
@@ -74,9 +110,17 @@ private:
 
     // --- BFS pathfinding state ---
     
-    std::queue<State> q;                                            ///< BFS queue.
-    std::map<State, State> parent;                                  ///< BFS parent map for path reconstruction.
-    std::vector<std::vector<std::vector<bool>>> visited;            ///< 3D visited grid (x, y, direction).
+    std::pmr::unsynchronized_pool_resource bfsMemory;               ///< Recycles queue and parent-map nodes between searches.
+    std::queue<State, std::pmr::deque<State>> q{&bfsMemory};        ///< BFS queue.
+    std::pmr::map<State, State> parent{&bfsMemory};                 ///< BFS parent map for path reconstruction.
+    std::vector<uint8_t> visited;                                   ///< Flat visited grid, index ((y * cols) + x) * 8 + direction.
+
+    /**
+     * @brief Returns the visited flag of a BFS state.
+     */
+    uint8_t& visitedAt(int x, int y, Direction dir) {
+        return visited[(static_cast<size_t>(y) * cols + x) * 8 + static_cast<size_t>(dir)];
+    }
 
     // --- BFS helper methods ---
 
@@ -106,7 +150,8 @@ private:
     std::pair<std::vector<ActionRequest>, std::vector<std::pair<int, int>>> reconstructPath(State current);
 
     /**
-     * @brief Attempts to move forward from the given state, adds to BFS if valid.
+     * @brief Attempts to move forward from the given state, adds to BFS if valid. Cells
+     *        outside the view window count as blocked, so a path stays inside the window.
      * @param current The state to move from.
      */
     void tryMoveForward(const State& current);
@@ -144,10 +189,30 @@ private:
      */
     void HandleBFS();
 
+    /**
+     * @brief Checks whether this turn's pass of chase, after its shoot delay update, would end
+     *        in ContinueAlongPath: the enemy is known and did not move, no threat is on the
+     *        tank, nothing is in sight to shoot, no battle info is due and the tank stands on
+     *        the next planned position.
+     */
+    bool canFollowPath();
+
     /**
      * @brief Executes the next action in the current path, updating the tank's internal state.
      * @return The next ActionRequest in the path.
      */
     ActionRequest ContinueAlongPath();
-    
+
+    // --- Decision coroutine ---
+
+    /**
+     * @brief The decision logic as a coroutine: one loop pass per turn, ended by the turn's
+     *        co_yield or co_await. Nothing is kept in locals from one turn to the next, so
+     *        the members above still describe the whole decision state (see stateHash).
+     * @return The strategy that getAction resumes.
+     */
+    TankStrategy chase(std::allocator_arg_t, std::pmr::memory_resource* frames);
+
+    TankStrategy strategy; ///< Resumed once per getAction; its frame lives in the resource given to the constructor.
+
 };
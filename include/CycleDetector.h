@@ -0,0 +1,58 @@
+#pragma once
+#include <vector>
+#include <memory_resource>
+#include <cstddef>
+#include <cstdint>
+#include "ActionRequestUtils.h"
+
+/**
+ * @class CycleDetector
+ * @brief Remembers the state hashes and output lines of the most recent turns so that
+ *        a game whose state repeats can be fast-forwarded.
+ *
+ * A ring buffer holds the end-of-turn state hash and output line of the last HISTORY turns.
+ * When the state after a turn equals the state after a turn `period` turns earlier, the
+ * game is deterministic from there on, so it replays the last `period` lines forever.
+ */
+class CycleDetector {
+public:
+    static constexpr size_t HISTORY = 256; ///< Turns remembered (longest detectable period is HISTORY - 1)
+
+private:
+    std::pmr::vector<uint64_t> hashes;    ///< State hash after each remembered turn (ring buffer)
+    std::pmr::vector<TurnAction> lines;   ///< Output line of each remembered turn, lineWidth entries each
+    size_t lineWidth = 0;                 ///< Entries per output line (number of tanks)
+    size_t next = 0;                      ///< Ring slot the next turn is recorded in
+    size_t count = 0;                     ///< Remembered turns (at most HISTORY)
+
+public:
+    /**
+     * @brief Constructs an empty detector whose buffers draw from the given memory resource.
+     */
+    explicit CycleDetector(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Sizes the buffers for output lines of the given width and forgets all turns.
+     */
+    void reset(size_t width);
+
+    /**
+     * @brief Forgets all turns (a turn that cannot be part of a cycle broke the history).
+     */
+    void forget() { count = 0; }
+
+    /**
+     * @brief Records a turn and looks for an earlier turn that ended in the same state.
+     * @param hash State hash after the turn.
+     * @param line Output line of the turn (lineWidth entries).
+     * @return The period of the cycle found, or 0 if the state is new.
+     */
+    size_t record(uint64_t hash, const TurnAction* line);
+
+    /**
+     * @brief Returns the output line of a future turn once a cycle was found.
+     * @param period Period returned by record().
+     * @param turn Turns played since the cycle was found, minus one (0 is the next turn).
+     */
+    const TurnAction* getReplayLine(size_t period, size_t turn) const;
+};
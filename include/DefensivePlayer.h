@@ -10,7 +10,7 @@
  * This class inherits from MyPlayer and creates a basic tank algorithm
  * that prioritizes safety using MyBattleInfo.
  */
-class DefensivePlayer : public MyPlayer {
+class DefensivePlayer final : public MyPlayer {
 public:
     /**
      * @brief Constructs a DefensivePlayer instance with game configuration parameters.
@@ -32,4 +32,12 @@ public:
      * @param satellite_view The satellite view of the board.
      */
     void updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satellite_view) override;
+
+    /**
+     * @brief Same as updateTankWithBattleInfo, typed on the concrete algorithm and view so the
+     *        calls into them are direct (instantiated for TankAlgorithm with SatelliteView, and
+     *        for BasicTankAlgorithm with MySatelliteView).
+     */
+    template <typename Algorithm, typename View>
+    void updateTank(Algorithm& tank, const View& satellite_view);
 };
\ No newline at end of file
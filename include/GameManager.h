@@ -6,10 +6,11 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
-#include <map>
+#include <memory_resource>
 
 #include "Board.h"
 #include "Tank.h"
+#include "TankTable.h"
 #include "Direction.h"
 #include "Entity.h"
 #include "Player.h"
@@ -20,6 +21,21 @@
 #include "MySatelliteView.h"
 #include "MyPlayer.h"
 #include "Cell.h"
+#include "OccupancyGrid.h"
+#include "ShellPool.h"
+#include "BitBoard.h"
+#include "ShellScheduler.h"
+#include "SatelliteRaster.h"
+#include "AllocationGuard.h"
+#include "CycleDetector.h"
+#include "StateHashable.h"
+#include "ActionPlanner.h"
+#include "PooledTankAlgorithmFactory.h"
+#include "BuiltinDispatch.h"
+#include "StateHash.h"
+#include "GameOptions.h"
+#include "ReachabilityAnalysis.h"
+#include "ThreadPool.h"
 
 /**
  * @class GameManager
@@ -31,8 +47,9 @@ class GameManager {
 public:
     /**
      * @brief Constructs the GameManager with factories for players and tank algorithms.
+     * @param options Optional engine behaviours (all off by default).
      */
-    GameManager(std::unique_ptr<PlayerFactory> pf, std::unique_ptr<TankAlgorithmFactory> tf);
+    GameManager(std::unique_ptr<PlayerFactory> pf, std::unique_ptr<TankAlgorithmFactory> tf, GameOptions options = {});
 
     GameManager(const GameManager&) = delete;
     GameManager& operator=(const GameManager&) = delete;
@@ -58,21 +75,71 @@ public:
 
 private:
     // -------------- Game state ---------------
-    std::vector<std::unique_ptr<Shell>> shells;
+    /// Per-game memory for every engine container and per-pass scratch list. Declared first
+    /// so it outlives them; readBoard hands everything back and releases it in one shot.
+    std::pmr::unsynchronized_pool_resource arena;
+    ShellPool shells; ///< All shells in flight (struct-of-arrays pool)
     std::vector<std::unique_ptr<Player>> players;
-    std::map<std::pair<int, int>, std::vector<Entity*>> positionMap;
-    ///< Maps tanks to their controlling algorithms.
-    std::vector<std::pair<std::unique_ptr<Tank>, std::unique_ptr<TankAlgorithm>>> tankPerAlgoVector;
+    OccupancyGrid occupancy; ///< Entities per board cell, updated incrementally.
+    BitBoard bitboard; ///< Bit-planes of terrain and entities used to resolve collisions.
+    TankTable tanks; ///< State of every tank plus its controlling algorithm (struct-of-arrays).
+    ShellScheduler scheduler; ///< Puts shells with a clear line ahead to sleep until they can hit something.
+    SatelliteRaster raster; ///< The board as this turn's satellite views show it (refreshed on demand).
+    std::pmr::vector<uint64_t> infoVersions; ///< Raster version of each tank's last battle info (0 = none), for delta infos.
+    std::pmr::vector<ShellHandle> firedShells; ///< Shells fired this turn, not yet registered in the occupancy grid.
+    std::pmr::vector<ShellHandle> shellsToRemove; ///< Shells marked by the current collision pass (reused).
+    std::pmr::vector<size_t> tanksToRemove; ///< Tanks marked by the current collision pass (reused).
+    CycleDetector cycles; ///< Recent end-of-turn states, used to fast-forward repeating games.
+    std::vector<const StateHashable*> algorithmStates; ///< State view of each tank's algorithm (cycle detection).
+    std::vector<const StateHashable*> playerStates; ///< State view of each player (cycle detection).
+    std::vector<uint64_t> cycleState;   ///< Full state after the turn whose hash repeated an earlier one.
+    std::vector<uint64_t> stateScratch; ///< Full state of the current turn, compared against cycleState.
+    size_t pendingPeriod = 0;           ///< Period of the repeat awaiting confirmation (0 = none).
+    int pendingStep = 0;                ///< Step whose full state was saved in cycleState.
+
+    static constexpr uint8_t PLAN_CAPACITY = 8; ///< Most actions taken from an ActionPlanner at once.
+
+    /**
+     * @brief Actions a tank committed to (see ActionPlanner) that were not played yet.
+     */
+    struct ActionPlan {
+        ActionRequest actions[PLAN_CAPACITY]; ///< The committed actions, in turn order
+        uint8_t next = 0;                     ///< Index of the action to play this turn
+        uint8_t size = 0;                     ///< Number of committed actions
+    };
+    std::vector<ActionPlanner*> planners; ///< Planning view of each tank's algorithm (null if it cannot plan).
+    std::pmr::vector<ActionPlan> plans;   ///< Per-tank plan being played back.
+    bool builtinTypes = false; ///< Every player and algorithm has its built-in type (calls go through BuiltinDispatch).
+    bool cycleDetection = false; ///< Whether every player and algorithm can hash its state.
+    uint64_t terrainHash = 0; ///< Zobrist hash of the terrain, updated on every terrain change.
+    GameOptions options; ///< Optional engine behaviours.
+    bool outcomeFixed = false; ///< Load-time analysis proved the final result line (short-circuit mode only).
+    std::unique_ptr<ThreadPool> workerPool; ///< Threads for the parallel decision and shell phases (null = serial).
+
+    /**
+     * @brief What one stripe's collision sweep found, merged into the game in stripe order.
+     *        The buffers use the global heap, which (unlike the arena) is safe from any thread.
+     */
+    struct StripeResult {
+        std::pmr::vector<ShellHandle> shellsHit; ///< Shells to remove, in sweep order
+        std::pmr::vector<size_t> tanksHit;       ///< Tanks to remove, in sweep order
+        uint64_t terrainDelta = 0;               ///< XOR change of terrainHash from the stripe's cells
+    };
+    std::vector<size_t> stripeBounds;        ///< First bitboard word of each stripe, then the word count.
+    std::vector<StripeResult> stripeResults; ///< Per-stripe sweep output (reused every pass).
     int stepCounter = 0;
 
     std::unique_ptr<PlayerFactory> playerFactory;
     std::unique_ptr<TankAlgorithmFactory> tankFactory;
+    const PooledTankAlgorithmFactory* pooledFactory = nullptr; ///< tankFactory's pooled side, given the arena (null if none).
 
     std::unique_ptr<Board> board;
-    std::vector<int> playerTankCount;
+    std::vector<int> playerTankCount; ///< Live tanks per player, updated as tanks die.
 
     int drawCountdown = -1;   ///< Countdown used to detect repeated draw states.
     int wantedCountdown = 40; ///< Threshold turns before triggering draw scenario.
+    static constexpr size_t MAX_RESERVED_SHELLS = size_t{1} << 16; ///< Cap on the shell capacity reserved up front.
+    static constexpr size_t MIN_SHELLS_PER_STRIPE = 4096; ///< Fewer awake shells per stripe are advanced serially.
     int maxSteps = 0;
     int numShells = 0;
     size_t rows = 0;
@@ -83,7 +150,7 @@ private:
     std::vector<std::string> inputErrors;
     std::unique_ptr<std::ofstream> ownedOutputLog;
     std::ostream* outputLog = nullptr;
-    std::vector<std::string> currentTurnActions;
+    std::vector<TurnAction> currentTurnActions; ///< This turn's output line, formatted when written.
     // std::string inputFileNameOnly;
 
 
@@ -98,12 +165,35 @@ private:
      */
     void processTurn();
 
+    /**
+     * @brief Asks every live tank's algorithm for its action and stores it in currentTurnActions.
+     *        Runs on workerPool when one exists; nothing is applied to the game here.
+     */
+    void collectActions();
+
+    /**
+     * @brief Finds the tank algorithms that can plan ahead and clears every plan.
+     */
+    void initActionPlans();
+
+    /**
+     * @brief Checks whether the game only holds the built-in player and algorithm types,
+     *        in which case they are called directly (see BuiltinDispatch).
+     */
+    void detectBuiltinTypes();
+
+    /**
+     * @brief Returns a tank's action for this turn: the next step of its plan, refilled
+     *        from the algorithm when used up, or a plain getAction call.
+     */
+    ActionRequest nextAction(size_t i);
+
     /**
      * @brief Applies a single action for a specific player.
      * Handles backward state if necessary.
      * @param action The action to apply.
      */
-    void applyAction(ActionRequest action, Tank& tank, TankAlgorithm& algot, size_t i);
+    void applyAction(ActionRequest action, Tank tank, TankAlgorithm& algot, size_t i);
 
     /**
      * @brief Moves all shells two steps with intermediate collision checks.
@@ -111,9 +201,10 @@ private:
     void moveShells();
 
     /**
-     * @brief Rebuilds the map linking positions to their occupying entities.
+     * @brief Brings the occupancy grid up to date with the tank moves and shots of the action phase.
+     *        Only tanks that changed cell and newly fired shells are touched.
      */
-    void rebuildPositionMap();
+    void syncOccupancy();
 
     /**
      * @brief Detects and resolves collisions between entities on the board.
@@ -121,25 +212,97 @@ private:
      */
     void resolveCollisions();
 
+    /**
+     * @brief Sweeps the dirty cells of bitboard words [firstWord, lastWord): updates their terrain
+     *        and collects the entities to remove. Touches nothing outside those cells, so
+     *        disjoint ranges can be swept concurrently.
+     */
+    void sweepCollisions(size_t firstWord, size_t lastWord, std::pmr::vector<ShellHandle>& shellsHit,
+                         std::pmr::vector<size_t>& tanksHit, uint64_t& terrainDelta);
+
+    /**
+     * @brief Advances every awake shell one cell, split in slot ranges over the stripe threads.
+     */
+    void advanceAwakeShells();
+
     /**
      * @brief Checks if the game has ended with a win, tie, or ongoing.
      * @return true if the game has ended, false otherwise.
      */
     bool checkWinConditions();
 
+    /**
+     * @brief Checks whether the armed tanks could fire their last shells early enough for the
+     *        zero-shells tie to end the game before maxSteps. Even when no tank can be
+     *        destroyed, the final result line then depends on when the algorithms shoot.
+     */
+    bool endDependsOnShooting() const;
+
     /**
      * @brief Determines the winner of the game based on remaining tanks.
      *        Updates the winner field (0 = tie, 1/2 = winning player).
      */
     void determineWinner();
 
+    /**
+     * @brief Debug cross-check of the incremental bookkeeping: recounts live tanks per player
+     *        and live armed tanks with a full scan and asserts they match the running counters.
+     *        Called every step when built with -DTANKS_CROSS_CHECK.
+     */
+    void verifyCounters() const;
+
+    /**
+     * @brief Test check of the zero-allocation turn loop: aborts if a turn allocated
+     *        (algorithm and player code is not counted; readBoard reserves everything up front).
+     *        Called every turn when built with -DTANKS_ALLOC_GUARD.
+     * @param allocations Number of allocations the engine made during the turn.
+     */
+    void verifyTurnAllocations(size_t allocations) const;
+
+    // ----------------------------------------------------------------
+    //                   CYCLE DETECTION UTILITIES
+    // ----------------------------------------------------------------
+
+    /**
+     * @brief Enables cycle detection if every player and algorithm implements StateHashable.
+     */
+    void initCycleDetection();
+
+    /**
+     * @brief Returns the Zobrist key of a cell's terrain (0 for an untouched empty cell).
+     * @param index Flat index of the cell.
+     */
+    uint64_t terrainKey(size_t index) const;
+
+    /**
+     * @brief Hashes the whole game state: terrain, live tanks, their algorithms and the players.
+     *        Only meaningful when no shell is in flight.
+     */
+    uint64_t computeStateHash() const;
+
+    /**
+     * @brief Writes the whole game state computeStateHash covers into out, in full: the board
+     *        cells, the tank and shell tables, every algorithm and every player.
+     */
+    void captureState(std::vector<uint64_t>& out) const;
+
+    /**
+     * @brief Records the finished turn and, if the game state repeats with no shell in flight
+     *        and no draw countdown running, replays the cycle's output lines up to maxSteps.
+     *        A repeated hash only marks a candidate; the replay starts once the full state one
+     *        period later equals the one saved at the candidate.
+     * @return true if the game was fast-forwarded to maxSteps.
+     */
+    bool fastForwardCycle();
+
     // ----------------------------------------------------------------
     //                   READBOARD UTILITIES
     // ----------------------------------------------------------------
 
     /**
      * @brief Resets all game state variables to their initial values.
-     *        Clears tanks, shells, players, counters, and board for fresh initialization.
+     *        Clears tanks, shells, players, counters, and board for fresh initialization,
+     *        and returns the per-game arena's memory.
      */
     void resetGameState();
 
@@ -170,7 +333,19 @@ private:
      */
     void placeTanks(const std::vector<std::string>& rawMap);
 
-        /**
+    /**
+     * @brief Reserves every per-turn container up to its bound for the loaded board, so the
+     *        turn loop itself never has to grow one.
+     */
+    void reserveTurnCapacity();
+
+    /**
+     * @brief Splits the board into options.shellStripes horizontal stripes of whole bitboard
+     *        words and reserves their sweep buffers. One stripe means the serial shell phase.
+     */
+    void initStripes();
+
+    /**
      * @brief Reads the raw map section from the input file.
      * @param file The input file stream.
      * @return A vector of strings representing the raw board layout.
@@ -188,60 +363,63 @@ private:
      * @param tank The player's tank.
      * @return true if backward handling was performed, false otherwise.
      */
-    bool handleBackwardState(ActionRequest action, Tank& tank, size_t i);
+    bool handleBackwardState(ActionRequest action, Tank tank, size_t i);
 
     /**
      * @brief Handles a normal tank action (move, rotate, shoot, wait).
      * @param action The action to perform.
      * @param tank The tank performing the action.
      */
-    void handleNormalAction(ActionRequest action, Tank& tank, TankAlgorithm& algot, size_t i);
+    void handleNormalAction(ActionRequest action, Tank tank, TankAlgorithm& algot, size_t i);
 
     // ----------------------------------------------------------------
     //                RESOLVE COLLISIONS UTILITIES
     // ----------------------------------------------------------------
 
+    /**
+     * @brief Removes every tank standing on a shell that flies against it, checking only
+     *        the cells entered this turn.
+     */
     void HeadOnCollision();
 
     /**
      * @brief Removes all shells marked for deletion.
-     * @param toRemove Set of shell pointers to remove.
+     * @param toRemove Handles of the shells to remove (duplicates are ignored).
      */
-    void removeMarkedShells(const std::set<Shell*>& toRemove);
+    void removeMarkedShells(const std::pmr::vector<ShellHandle>& toRemove);
 
     /**
      * @brief Removes all tanks marked for deletion.
-     * @param toRemove Set of tank pointers to remove.
+     * @param toRemove Indices of the tanks to remove (duplicates are ignored).
      */
-    void removeMarkedTanks(const std::set<Tank*>& toRemove);
+    void removeMarkedTanks(const std::pmr::vector<size_t>& toRemove);
 
     /**
-     * @brief Splits a list of generic entities into two separate vectors:
-     *        one containing only tanks and the other containing only shells.
-     * @param entities A vector of pointers to Entity objects.
-     * @return A pair of vectors: (tanks, shells).
+     * @brief Rebuilds the bitboard's tank planes, once per shell phase (tanks do not move during it).
      */
-    std::pair<std::vector<Tank*>, std::vector<Shell*>> separateEntities(const std::vector<Entity*>& entities);
+    void rebuildTankPlanes();
 
     /**
-     * @brief Determines if the tanks in the given cell should be removed,
-     *        based on the presence of shells or other game rules.
-     * @param cell The cell being evaluated.
-     * @param tanks List of tanks currently in the cell.
-     * @param shells List of shells currently in the cell.
-     * @return True if the tanks should be removed from the game.
+     * @brief Checks whether the lone shell on a cell collided head-on with a shell
+     *        coming from the opposite direction (they swapped cells this step).
+     * @param index Flat index of a cell holding exactly one shell.
+     * @return True if the shell should be removed from the game.
      */
-    bool shouldRemoveTanks(Cell& cell, const std::vector<Tank*>& tanks, const std::vector<Shell*>& shells);
+    bool isHeadOnHit(size_t index) const;
 
     /**
-     * @brief Determines if the shells in the given cell should be removed,
-     *        typically based on collisions or interactions with tanks.
-     * @param cell The cell being evaluated.
-     * @param tanks List of tanks currently in the cell.
-     * @param shells List of shells currently in the cell.
-     * @return True if the shells should be removed from the game.
+     * @brief Removes the mine of a cell after a tank stepped on it.
+     * @param index Flat index of the cell.
+     * @param hash Terrain hash (or stripe delta) the change is folded into.
      */
-    bool shouldRemoveShells(Cell& cell, const std::vector<Tank*>& tanks, const std::vector<Shell*>& shells);
+    void detonateMine(size_t index, uint64_t& hash);
+
+    /**
+     * @brief Registers a hit on the wall of a cell; the second hit destroys the wall.
+     * @param index Flat index of the cell.
+     * @param hash Terrain hash (or stripe delta) the change is folded into.
+     */
+    void hitWall(size_t index, uint64_t& hash);
 
     
     // ----------------------------------------------------------------
@@ -266,6 +444,13 @@ private:
      */
     void initOutputLogFromInputFile(const std::string& inputFileName);
 
+    /**
+     * @brief Writes one turn's output line.
+     * @param actions The turn's entries, one per tank.
+     * @param count Number of entries.
+     */
+    void writeTurnActions(const TurnAction* actions, size_t count);
+
     // /**
     //  * @brief Writes the current board state into a file ("boards.txt").
     //  * Each board is separated by a line containing "===".
@@ -278,7 +463,14 @@ private:
     // ----------------------------------------------------------------
         
     /**
-     * @brief Moves all shells one step forward according to their direction.
+     * @brief Moves all awake shells one step forward according to their direction and records
+     *        them in the bitboard's shell planes. Sleeping shells due this step, or whose line
+     *        was entered, are woken as well.
      */
     void moveShellsOneStep();
+
+    /**
+     * @brief Puts to sleep the awake shells that cannot hit anything for a while.
+     */
+    void sleepClearShells();
 };
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+/**
+ * @struct GameOptions
+ * @brief Optional engine behaviours, off by default (set from command-line flags in main).
+ */
+struct GameOptions {
+    /// Skip simulating games whose outcome is fixed at load time: no tank can be destroyed
+    /// (see ReachabilityAnalysis) and, for armed games, maxSteps comes before the zero-shells
+    /// tie could. Only the final result line is written for them, not the per-turn action lines.
+    bool shortCircuitFixedOutcomes = false;
+
+    /// Threads used to run the tanks' getAction calls each turn (0 or 1 = serial), and the
+    /// shell stripes when set. Actions are still applied in tank order, so the output does
+    /// not depend on it.
+    size_t decisionThreads = 0;
+
+    /// Horizontal stripes the board is split into for the shell phase (0 or 1 = one stripe),
+    /// swept on decisionThreads threads, or each on its own thread when that is 0. Results are
+    /// merged in stripe order, so the output does not depend on either.
+    size_t shellStripes = 0;
+
+    /// Let a tank's battle info list only the cells changed since its previous one, applied by
+    /// the built-in algorithms to the grid they kept. Only used when every player and algorithm
+    /// is built in; the tanks end up with the same grids, so the output does not depend on it.
+    bool deltaBattleInfo = false;
+
+    /// Hand tanks a shared snapshot of the board instead of a classified copy; the built-in
+    /// algorithms classify only the cells they read. Only used when every player and algorithm
+    /// is built in, and takes precedence over deltaBattleInfo. The tanks read the same types,
+    /// so the output does not depend on it.
+    bool lazyBattleInfo = false;
+
+    /// Limit each battle info to the cells within this many steps of the requesting tank along
+    /// both axes, wrapping around the board edges (0 = the whole board). Cells outside the
+    /// window read as '?' (ObjectType::Unknown). Unlike the options above, this changes what
+    /// the tanks see and therefore the game.
+    size_t viewRadius = 0;
+};
@@ -2,6 +2,11 @@
 #include "BattleInfo.h"
 #include "SatelliteView.h"
 #include "ObjectType.h"
+#include "EntityQueryView.h"
+#include "RasterSnapshot.h"
+#include "ViewWindow.h"
+#include <memory>
+#include <cstdint>
 #include <vector>
 #include <set>
 #include <utility>
@@ -11,23 +16,47 @@
  * 
  * This class stores a full grid of detected objects (walls, mines, tanks, shells),
  * the position of the calling tank, enemy tank, and shell locations.
- * It is constructed using a SatelliteView and player-specific data.
+ * It is constructed using a SatelliteView and player-specific data. A delta info holds no
+ * grid, only the cells that may have changed since the tank's previous info and their new
+ * types; the tank applies them to the grid it kept. A lazy info holds no grid either, only a
+ * snapshot of the board that the tank classifies where it reads it (see ObjectGrid).
  */
 class MyBattleInfo : public BattleInfo {
 private:
-    std::vector<std::vector<ObjectType>> grid; ///< 2D grid representing object types
+    std::vector<std::vector<ObjectType>> grid; ///< 2D grid representing object types (empty in a delta)
+    bool delta = false; ///< Whether this info only lists changed cells
+    std::vector<std::pair<int, int>> changedCells; ///< Cells that may have changed (delta only)
+    std::vector<ObjectType> changedTypes; ///< Current type of each changed cell (delta only)
+    std::shared_ptr<const RasterSnapshot> snapshot; ///< Board to read lazily (lazy only)
+    ViewWindow window; ///< Part of the snapshot that may be read (lazy only)
+    std::vector<std::pair<int, int>> selfCells; ///< Cells showing '%', when read from entity lists
+    int playerIndex = 0; ///< Player the info was built for
     std::pair<int, int> myPosition = {-1, -1}; ///< Position of this player's tank
     std::pair<int, int> enemyPosition = {-1, -1}; ///< Last known enemy position
+    std::pair<int, int> firstSelfPosition = {-1, -1}; ///< First '%' in row-major order (myPosition keeps the last)
     std::set<std::pair<int, int>> shellsPositions; ///< Set of shell coordinates
+    std::vector<std::pair<int, int>> enemyTanks; ///< Enemy tank coordinates in row-major order
     int numShells; ///< Number of shells remaining
 
+    /**
+     * @brief Records the shells, the '%' cells and the enemy tanks of a classified row.
+     */
+    void recordRow(size_t y, size_t cols, const uint64_t* shells, const uint64_t* self, const uint64_t* enemies);
+
+    /**
+     * @brief Records the same positions as recordRow from the view's entity lists.
+     */
+    void recordEntities(const EntityQueryView& query, int playerIndex, size_t cols);
 
 public:
     /**
      * @brief Constructs battle info from a satellite view.
      * 
-     * Parses the entire visible board using `view.getObjectAt()` and fills internal structures.
-     * Also stores the shell count and player-specific visibility.
+     * Reads the board a row at a time, through BulkSatelliteView::copyRow when the view offers
+     * it and `view.getObjectAt()` otherwise, classifies each row with classifyViewRow and fills
+     * internal structures. The tanks and shells are taken from the view's entity lists when it
+     * is an EntityQueryView. Also stores the shell count and player-specific visibility. View
+     * is either SatelliteView or MySatelliteView, whose copyRow is then called directly.
      * 
      * @param view Global satellite view of the board
      * @param playerIndex Index of the player (1 or 2)
@@ -35,7 +64,8 @@ public:
      * @param cols Number of columns on the board
      * @param numShells Number of shells available to this tank
      */
-    MyBattleInfo(const SatelliteView& view, int playerIndex, size_t rows, size_t cols, int numShells);
+    template <typename View>
+    MyBattleInfo(const View& view, int playerIndex, size_t rows, size_t cols, int numShells);
     ~MyBattleInfo() override = default;
 
     /** @brief Returns the current tank's position. */
@@ -44,11 +74,41 @@ public:
     /** @brief Returns the last known position of the enemy tank. */
     std::pair<int, int> getEnemyPosition() const { return enemyPosition; }
 
+    /** @brief Returns the first position showing this tank ('%'), or {-1, -1}. */
+    std::pair<int, int> getFirstSelfPosition() const { return firstSelfPosition; }
+
+    /** @brief Returns the enemy tank positions seen in the view, in row-major order. */
+    const std::vector<std::pair<int, int>>& getEnemyTanks() const { return enemyTanks; }
+
     /** @brief Returns the set of all known shell positions. */
     std::set<std::pair<int, int>> getShellsPositions() const { return shellsPositions; }
 
     /** @brief Returns the full 2D object grid parsed from the satellite view. */
-    std::vector<std::vector<ObjectType>> getGrid() const { return grid; }
+    const std::vector<std::vector<ObjectType>>& getGrid() const { return grid; }
+
+    /** @brief Returns whether this info lists changed cells instead of carrying a grid. */
+    bool isDelta() const { return delta; }
+
+    /** @brief Returns the cells that may have changed since the tank's previous info (delta only). */
+    const std::vector<std::pair<int, int>>& getChangedCells() const { return changedCells; }
+
+    /** @brief Returns the current type of each changed cell, in the same order (delta only). */
+    const std::vector<ObjectType>& getChangedTypes() const { return changedTypes; }
+
+    /** @brief Returns whether this info carries a snapshot instead of a grid. */
+    bool isLazy() const { return snapshot != nullptr; }
+
+    /** @brief Returns the snapshot of the board (lazy only). */
+    const std::shared_ptr<const RasterSnapshot>& getSnapshot() const { return snapshot; }
+
+    /** @brief Returns the part of the snapshot the tank may see (lazy only). */
+    const ViewWindow& getWindow() const { return window; }
+
+    /** @brief Returns the cells showing this tank as '%' (empty unless the view lists its entities). */
+    const std::vector<std::pair<int, int>>& getSelfCells() const { return selfCells; }
+
+    /** @brief Returns the player the info was built for. */
+    int getPlayerIndex() const { return playerIndex; }
 
     /** @brief Returns the number of shells this tank has left. */
     int getNumShells() const { return numShells; }
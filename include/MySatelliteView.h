@@ -1,12 +1,19 @@
 #pragma once
 
 #include "SatelliteView.h"
+#include "BulkSatelliteView.h"
+#include "EntityQueryView.h"
+#include "DeltaSatelliteView.h"
+#include "SnapshotSatelliteView.h"
 #include "Entity.h"
 #include "Board.h"
-#include "Tank.h"
-#include "Shell.h"
+#include "TankTable.h"
 #include "Cell.h"
-#include <map>
+#include "OccupancyGrid.h"
+#include "SatelliteRaster.h"
+#include "ViewWindow.h"
+#include <cstdint>
+#include <memory>
 #include <vector>
 #include <utility>
 
@@ -14,26 +21,49 @@
  * @brief A concrete implementation of SatelliteView providing a read-only view of the board.
  * 
  * Allows a tank to query the state of any cell on the board, including terrain, other tanks,
- * and shells. Used by the algorithm to get a global picture of the game.
+ * and shells. Used by the algorithm to get a global picture of the game. getObjectAt is
+ * defined here so that scans templated on the concrete view type can inline it; copyRow
+ * serves whole rows straight from the shared raster, and the entity queries read the
+ * engine's tank table and the raster's entity cells without visiting the rest of the board.
+ * Given the raster version the requesting tank saw last, it also lists the cells changed
+ * since then from the raster's journal, and it can carry a snapshot of the raster for tanks
+ * that read the board lazily. A view can be limited to a window around the requesting tank;
+ * cells outside it read as '?' and their entities are not listed.
  */
-class MySatelliteView : public SatelliteView {
+class MySatelliteView final : public SatelliteView, public BulkSatelliteView, public EntityQueryView,
+                              public DeltaSatelliteView, public SnapshotSatelliteView {
 private:
     const Board& board;
-    const std::map<std::pair<int, int>, std::vector<Entity*>>& positionMap;
+    const SatelliteRaster& raster;
+    const OccupancyGrid& occupancy;
+    const TankTable& tanks;
     int rows;
     int cols;
     std::pair<int, int> requestingTankPosition;
+    uint64_t knownVersion = 0; ///< Raster version the requesting tank saw last (0 = no delta offered)
+    std::shared_ptr<const RasterSnapshot> rasterSnapshot; ///< Snapshot offered to the reader (null = none)
+    ViewWindow window;         ///< Part of the board shown (unlimited by default)
+    bool windowed = false;     ///< Whether the window leaves part of the board out
+
+    /**
+     * @brief Checks whether an in-bounds cell is shown.
+     */
+    bool isShown(size_t x, size_t y) const { return !windowed || window.contains(x, y, (size_t)rows, (size_t)cols); }
 
 public:
     /**
      * @brief Constructs a satellite view for the specified tank.
      * 
      * @param board The full game board.
-     * @param posMap The mapping of positions to entities (tanks, shells).
+     * @param raster The turn's shared view of the board (must be refreshed).
+     * @param occupancy The per-cell index of entities, used to find the tank on a cell.
+     * @param tanks The engine's tanks, used to recognize the requesting tank.
      * @param requestingTankPos The position of the tank requesting the view (used to identify itself).
      */
     MySatelliteView(const Board& board,
-                    const std::map<std::pair<int, int>, std::vector<Entity*>>& posMap,
+                    const SatelliteRaster& raster,
+                    const OccupancyGrid& occupancy,
+                    const TankTable& tanks,
                     std::pair<int, int> requestingTankPos);
 
     /**
@@ -45,8 +75,115 @@ public:
      */
     char getObjectAt(size_t x, size_t y) const override;
 
+    /**
+     * @brief Copies row y of the raster, then patches the requesting tank's cell to '%'.
+     *
+     * @param y Row index (0-based)
+     * @param out Buffer of at least cols characters
+     */
+    void copyRow(size_t y, char* out) const override;
+
+    /**
+     * @brief Lists the alive tanks at the cells they held at the start of the turn.
+     *
+     * @param out Receives the tanks in tank-table order
+     */
+    void listTanks(std::vector<TankSighting>& out) const override;
+
+    /**
+     * @brief Lists the cells the raster shows as '*'.
+     *
+     * @param out Receives the shell cells
+     */
+    void listShells(std::vector<std::pair<int, int>>& out) const override;
+
+    /**
+     * @brief Offers deltas against the given raster version (0, the default, offers none).
+     *
+     * @param version Version of the raster the requesting tank's last view showed
+     */
+    void setKnownVersion(uint64_t version) { knownVersion = version; }
+
+    /**
+     * @brief Lists the journaled cells changed since the known version, plus every tank's cell
+     *        (which tank shows as '%' is not journaled).
+     *
+     * @param out Receives the cells
+     * @return False if no version is known, the journal no longer reaches back to it, or the
+     *         view is windowed
+     */
+    bool listChangedCells(std::vector<std::pair<int, int>>& out) const override;
+
+    /**
+     * @brief Offers a snapshot of the raster to the reader (null, the default, offers none).
+     *
+     * @param snapshot The raster's snapshot for this turn
+     */
+    void setSnapshot(std::shared_ptr<const RasterSnapshot> snapshot) { rasterSnapshot = std::move(snapshot); }
+
+    /**
+     * @brief Returns the snapshot set by setSnapshot, if any.
+     */
+    std::shared_ptr<const RasterSnapshot> snapshot() const override { return rasterSnapshot; }
+
+    /**
+     * @brief Returns the window the view is limited to.
+     */
+    ViewWindow snapshotWindow() const override { return window; }
+
+    /**
+     * @brief Limits the view to a window (deltas are then no longer offered, since the window
+     *        moves with the tank).
+     *
+     * @param shown The part of the board to show
+     */
+    void setWindow(const ViewWindow& shown) {
+        window = shown;
+        windowed = !shown.coversBoard((size_t)rows, (size_t)cols);
+    }
+
     /**
      * @brief Default destructor.
      */
     ~MySatelliteView() override = default;
 };
+
+/**
+ * @brief Returns a character representing the object at the given board coordinates.
+ * 
+ * The character can be:
+ * - '#' for a wall
+ * - '@' for a mine
+ * - '*' for a shell
+ * - '1' or '2' for a tank owned by player 1 or 2
+ * - '%' for the requesting tank itself
+ * - ' ' for empty space
+ * - '&' for out-of-bounds access
+ * - '?' for a cell outside the view window
+ * 
+ * @param x Column index (0-based) - represents X-axis (cols)
+ * @param y Row index (0-based)    - represents Y-axis (rows)
+ * @return A char representing the object at the specified coordinates
+ */
+inline char MySatelliteView::getObjectAt(size_t x, size_t y) const {
+    if (y >= (size_t)rows || x >= (size_t)cols){
+        return '&';
+    }
+    if (!isShown(x, y)) {
+        return '?';
+    }
+
+    size_t index = board.toIndex((int)x, (int)y);
+    char c = raster.at(index);
+    if (c != '1' && c != '2') {
+        return c;
+    }
+
+    // The requesting tank sees itself as '%'
+    size_t tank = 0;
+    occupancy.forEachAt(index, [&](Occupant occupant) {
+        tank = occupant.index;
+        return occupant.type == EntityType::Tank;
+    });
+    return tanks.getPosition(tank) == requestingTankPosition ? '%' : c;
+}
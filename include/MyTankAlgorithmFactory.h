@@ -1,18 +1,21 @@
 #pragma once
 
 #include "TankAlgorithmFactory.h"
+#include "PooledTankAlgorithmFactory.h"
 #include "TankAlgorithm.h"
 #include "MyTankAlgorithm.h"
 #include "BasicTankAlgorithm.h"
 #include "ChasingTankAlgorithm.h"
 #include <memory>
+#include <memory_resource>
 
 /**
  * @brief Factory that creates different tank algorithms based on player index.
  * 
  * Player 1 receives a BasicTankAlgorithm, while player 2 receives a ChasingTankAlgorithm.
+ * Given a game's arena, the ChasingTankAlgorithm strategy frames are allocated from it.
  */
-class MyTankAlgorithmFactory : public TankAlgorithmFactory {
+class MyTankAlgorithmFactory : public TankAlgorithmFactory, public PooledTankAlgorithmFactory {
 public:
     /**
      * @brief Creates a tank algorithm instance per player.
@@ -22,11 +25,23 @@ public:
      * @return A smart pointer to the created tank algorithm.
      */
     std::unique_ptr<TankAlgorithm> create(int player_index, int tank_index) const override {
+        return create(player_index, tank_index, std::pmr::get_default_resource());
+    }
+
+    /**
+     * @brief Creates a tank algorithm instance per player, its strategy frame in frames.
+     *
+     * @param player_index Index of the player (1 or 2).
+     * @param tank_index Index of the tank (usually 0).
+     * @param frames Resource the coroutine frames are allocated from.
+     * @return A smart pointer to the created tank algorithm.
+     */
+    std::unique_ptr<TankAlgorithm> create(int player_index, int tank_index, std::pmr::memory_resource* frames) const override {
         if (player_index == 1){
             return std::make_unique<BasicTankAlgorithm>(player_index, tank_index);
         }
         else {
-            return std::make_unique<ChasingTankAlgorithm>(player_index, tank_index);
+            return std::make_unique<ChasingTankAlgorithm>(player_index, tank_index, frames);
         }
     }
 
@@ -0,0 +1,101 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "ObjectType.h"
+#include "RasterSnapshot.h"
+#include "ViewWindow.h"
+
+/**
+ * @class ObjectGrid
+ * @brief A tank's picture of the board, one ObjectType per cell, read through at(x, y).
+ *
+ * The grid is either eager, holding the types a full battle info classified, or lazy,
+ * bound to a RasterSnapshot that is classified only where it is read. Lazy cells are
+ * classified a tile of 8x8 cells at a time on first access and cached, so a tank that
+ * looks at a ray fan and its neighbourhood classifies a few tiles instead of the board.
+ * A lazy grid may be limited to a window of the snapshot; cells outside it are Unknown.
+ * Both forms answer with the types MyBattleInfo gives for the same view.
+ */
+class ObjectGrid {
+private:
+    static constexpr size_t TILE_SHIFT = 3;                   ///< Tiles are (1 << TILE_SHIFT) cells wide and high
+    static constexpr size_t TILE_SIZE = size_t{1} << TILE_SHIFT;
+    using Tile = std::array<ObjectType, TILE_SIZE * TILE_SIZE>; ///< Row-major types of one tile
+
+    size_t rows = 0;
+    size_t cols = 0;
+    std::vector<ObjectType> cells; ///< Row-major types (eager form)
+
+    std::shared_ptr<const RasterSnapshot> source;  ///< Board being read (lazy form, null when eager)
+    std::vector<std::pair<int, int>> selfCells;    ///< Cells showing the tank itself ('%')
+    int playerIndex = 0;                           ///< Player the digits are classified for
+    ViewWindow window;                             ///< Part of the snapshot the tank sees
+    bool windowed = false;                         ///< Whether the window leaves part of the board out
+    size_t tilesPerRow = 0;
+    mutable std::vector<uint32_t> tileSlots; ///< 1 + index in tiles of each classified tile (0 = not yet)
+    mutable std::vector<Tile> tiles;         ///< Classified tiles, in order of first access
+    mutable std::vector<size_t> tileIds;     ///< Tile number of each entry of tiles
+
+    /**
+     * @brief Classifies a tile of the snapshot and returns its slot.
+     */
+    uint32_t materialize(size_t tile) const;
+
+public:
+    /**
+     * @brief Replaces the grid with fully classified rows.
+     */
+    void assign(const std::vector<std::vector<ObjectType>>& grid);
+
+    /**
+     * @brief Rebinds the grid to a snapshot, dropping the tiles classified for the previous one.
+     * @param snapshot The board shown to the tank.
+     * @param self Cells showing the tank itself.
+     * @param player Player the tank belongs to.
+     * @param shown Part of the snapshot the tank sees.
+     */
+    void bind(std::shared_ptr<const RasterSnapshot> snapshot, const std::vector<std::pair<int, int>>& self, int player,
+              const ViewWindow& shown = ViewWindow{});
+
+    /**
+     * @brief Overwrites a cell of an eager grid.
+     */
+    void set(int x, int y, ObjectType type) { cells[static_cast<size_t>(y) * cols + static_cast<size_t>(x)] = type; }
+
+    /**
+     * @brief Returns the type of an in-bounds cell.
+     */
+    ObjectType at(int x, int y) const {
+        if (!source) return cells[static_cast<size_t>(y) * cols + static_cast<size_t>(x)];
+        if (windowed && !window.contains(static_cast<size_t>(x), static_cast<size_t>(y), rows, cols)) return ObjectType::Unknown;
+        size_t tile = (static_cast<size_t>(y) >> TILE_SHIFT) * tilesPerRow + (static_cast<size_t>(x) >> TILE_SHIFT);
+        uint32_t slot = tileSlots[tile];
+        if (slot == 0) slot = materialize(tile);
+        return tiles[slot - 1][((static_cast<size_t>(y) & (TILE_SIZE - 1)) << TILE_SHIFT) | (static_cast<size_t>(x) & (TILE_SIZE - 1))];
+    }
+
+    /**
+     * @brief Checks whether every cell is ObjectType::Empty (true before the first update);
+     *        a lazy grid answers from the snapshot's non-blank count without classifying.
+     */
+    bool allEmpty() const;
+
+    /**
+     * @brief Returns whether the grid is bound to a snapshot.
+     */
+    bool isLazy() const { return source != nullptr; }
+
+    /**
+     * @brief Returns the number of rows.
+     */
+    size_t getRows() const { return rows; }
+
+    /**
+     * @brief Returns the number of columns.
+     */
+    size_t getCols() const { return cols; }
+};
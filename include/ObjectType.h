@@ -1,13 +1,15 @@
 #pragma once
+#include <cstdint>
 
 /**
  * @brief Enumeration representing different types of objects on the board.
  */
-enum class ObjectType {
+enum class ObjectType : uint8_t {
     Empty,     ///< No object (free cell)
     Wall,      ///< Indestructible or destructible wall
     Mine,      ///< Mine that destroys tanks
     Shell,     ///< Active shell (bullet)
     AllyTank,  ///< A tank that belongs to the current player
-    EnemyTank  ///< A tank that belongs to the opposing player
+    EnemyTank, ///< A tank that belongs to the opposing player
+    Unknown    ///< Outside the requesting tank's view window
 };
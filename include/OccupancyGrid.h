@@ -0,0 +1,132 @@
+#pragma once
+#include <vector>
+#include <memory_resource>
+#include <cstddef>
+#include <cstdint>
+#include "Entity.h"
+
+/**
+ * @brief Reference to an entity standing on the board: a tank index or a shell handle.
+ */
+struct Occupant {
+    EntityType type; ///< Whether index refers to a tank or a shell
+    uint32_t index;  ///< Tank index (Tank) or ShellHandle (Shell)
+};
+
+/**
+ * @class OccupancyGrid
+ * @brief Dense per-cell index of the entities (tanks and shells) standing on the board.
+ *
+ * Every cell holds the head of an intrusive list of occupants; the links and the cell of
+ * each occupant are kept in per-tank and per-shell arrays owned by the grid, so lookups,
+ * insertions and moves are O(1) and no memory is allocated per cell. The grid also records every cell that an
+ * entity entered since the last collision pass, which lets collision resolution visit
+ * only the cells that actually changed.
+ */
+class OccupancyGrid {
+private:
+    static constexpr uint32_t NONE = UINT32_MAX; ///< Empty list / end of list marker
+
+    std::pmr::vector<uint32_t> heads;       ///< Encoded first occupant of each cell (NONE if free)
+    std::pmr::vector<uint32_t> tankNext;    ///< Encoded next occupant after each tank
+    std::pmr::vector<uint32_t> shellNext;   ///< Encoded next occupant after each shell handle
+    std::pmr::vector<size_t> tankCell;      ///< Cell each tank is registered at
+    std::pmr::vector<size_t> shellCell;     ///< Cell each shell handle is registered at
+    std::pmr::vector<size_t> changedCells;  ///< Cells entered since the last call to clearChangedCells()
+    std::pmr::vector<uint8_t> changedFlags; ///< Per-cell flag mirroring changedCells (avoids duplicates)
+
+    /** @brief Packs an occupant into a single word (low bit = shell flag). */
+    static uint32_t encode(EntityType type, uint32_t index) {
+        return (index << 1) | (type == EntityType::Shell ? 1u : 0u);
+    }
+
+    /** @brief Returns the link slot that stores the successor of an encoded occupant. */
+    uint32_t& nextOf(uint32_t ref) { return (ref & 1u) ? shellNext[ref >> 1] : tankNext[ref >> 1]; }
+
+    /** @brief Returns the successor of an encoded occupant. */
+    uint32_t nextOf(uint32_t ref) const { return (ref & 1u) ? shellNext[ref >> 1] : tankNext[ref >> 1]; }
+
+    /** @brief Returns the slot that stores the cell of an encoded occupant. */
+    size_t& cellOf(uint32_t ref) { return (ref & 1u) ? shellCell[ref >> 1] : tankCell[ref >> 1]; }
+
+    /**
+     * @brief Records that an entity entered the given cell.
+     */
+    void markChanged(size_t cell);
+
+    /**
+     * @brief Links an encoded occupant at the head of a cell.
+     */
+    void link(uint32_t ref, size_t cell);
+
+    /**
+     * @brief Unlinks an encoded occupant from the cell it is registered at.
+     */
+    void unlink(uint32_t ref);
+
+public:
+    /**
+     * @brief Constructs an empty grid whose arrays draw from the given memory resource.
+     */
+    explicit OccupancyGrid(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Clears the grid and resizes it to the given number of cells.
+     */
+    void reset(size_t cellCount);
+
+    /**
+     * @brief Reserves the per-occupant arrays for the given numbers of tanks and shell handles.
+     */
+    void reserve(size_t tankCount, size_t shellCount);
+
+    /**
+     * @brief Adds an entity to a cell.
+     */
+    void insert(EntityType type, uint32_t index, size_t cell);
+
+    /**
+     * @brief Removes an entity from the cell it is registered at.
+     */
+    void erase(EntityType type, uint32_t index);
+
+    /**
+     * @brief Moves an entity from the cell it is registered at to another cell.
+     */
+    void move(EntityType type, uint32_t index, size_t to);
+
+    /**
+     * @brief Returns the cell an entity is registered at.
+     */
+    size_t getCell(EntityType type, uint32_t index) const {
+        return type == EntityType::Shell ? shellCell[index] : tankCell[index];
+    }
+
+    /**
+     * @brief Checks whether no entity stands on the given cell.
+     */
+    bool isFree(size_t cell) const { return heads[cell] == NONE; }
+
+    /**
+     * @brief Calls visit(Occupant) for every entity standing on the given cell.
+     *        Stops early and returns true as soon as visit returns true.
+     */
+    template <typename Visitor>
+    bool forEachAt(size_t cell, Visitor&& visit) const {
+        for (uint32_t ref = heads[cell]; ref != NONE; ref = nextOf(ref)) {
+            Occupant occupant{(ref & 1u) ? EntityType::Shell : EntityType::Tank, ref >> 1};
+            if (visit(occupant)) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns the cells entered by an entity since the last clearChangedCells().
+     */
+    const std::pmr::vector<size_t>& getChangedCells() const { return changedCells; }
+
+    /**
+     * @brief Forgets the recorded changed cells (capacity is kept).
+     */
+    void clearChangedCells();
+};
@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @class RasterSnapshot
+ * @brief An immutable copy of the satellite raster at one refresh.
+ *
+ * Rows are shared between consecutive snapshots: taking a new one copies only the rows
+ * that changed since the previous snapshot and points at the old ones otherwise, so a tank
+ * can keep the board it was shown for as long as it likes at a cost proportional to the
+ * rows that changed, not to the board.
+ */
+class RasterSnapshot {
+public:
+    using Row = std::shared_ptr<const std::vector<char>>;
+
+    size_t rows = 0;            ///< Number of rows on the board
+    size_t cols = 0;            ///< Number of columns on the board
+    std::vector<Row> rowChars;  ///< Characters of each row (never modified once shared)
+    uint64_t contentHash = 0;   ///< Hash of the characters (equal rasters hash equally)
+    size_t nonBlankCells = 0;   ///< Cells showing something other than ' '
+
+    /**
+     * @brief Returns the cols characters of row y.
+     */
+    const char* row(size_t y) const { return rowChars[y]->data(); }
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "Board.h"
+#include "TankTable.h"
+
+/**
+ * @class ReachabilityAnalysis
+ * @brief Load-time analysis of where tanks and their shells can go.
+ *
+ * A wall breaks after two hits, so a tank with `a` shells can break at most a / 2 walls.
+ * The reach set of a tank is every cell it can get to (with board wrap-around, over the 8
+ * neighbours of each cell) by breaking at most that many walls. Shells fly in a straight
+ * line over empty cells and mines, so a tank's shells stay inside its reach set and can
+ * only ever hit the walls bordering it once more, too few hits to break one of them.
+ *
+ * The outcome is fixed when no tank can ever be destroyed:
+ * - no two reach sets share or touch a cell, so tanks never meet and no shell ever
+ *   enters another tank's reach set;
+ * - no two armed tanks border the same wall, which their shells could break together;
+ * - no reach set holds a mine;
+ * - no armed tank can run into its own shell. A tank moves one cell per turn while a
+ *   shell moves two, so this takes a shell wrapping around the board: flying k cells
+ *   across a dimension of D cells, with 3 * (k + 1) >= 2 * D.
+ */
+class ReachabilityAnalysis {
+private:
+    static constexpr uint32_t NO_TANK = UINT32_MAX;   ///< Owner of a cell outside every reach set
+    static constexpr uint32_t UNREACHED = UINT32_MAX; ///< Cost of a cell outside the current reach set
+
+    std::vector<uint32_t> reachOf; ///< Tank whose reach set holds each cell (NO_TANK if none)
+    std::vector<uint32_t> hitBy;   ///< Armed tank whose shells can hit each bordering wall (NO_TANK if none)
+    std::vector<uint32_t> cost;    ///< Walls to break to get to each cell from the current tank (scratch)
+    std::vector<size_t> reach;     ///< Cells of the current tank's reach set (scratch)
+    std::vector<uint8_t> walked;   ///< Cells of the reach set already walked in one direction (scratch)
+    bool outcomeFixed = false;
+
+    /**
+     * @brief Collects into reach the cells a tank gets to by breaking at most budget walls
+     *        (a 0-1 BFS: entering a wall costs 1, any other cell 0).
+     */
+    void collectReach(const Board& board, size_t start, uint32_t budget);
+
+    /**
+     * @brief Marks the current reach set as the given tank's.
+     * @return false if it shares or touches another reach set, holds a mine, or (armed
+     *         tanks only) borders a wall another armed tank can hit.
+     */
+    bool claimReach(const Board& board, uint32_t tank, bool armed);
+
+    /**
+     * @brief Checks whether a shell fired inside the current reach set can fly far enough
+     *        across the wrapped board to meet the tank that fired it.
+     */
+    bool canMeetOwnShell(const Board& board);
+
+public:
+    /**
+     * @brief Analyzes a freshly loaded board and its tanks.
+     */
+    ReachabilityAnalysis(const Board& board, const TankTable& tanks);
+
+    /**
+     * @brief Returns true if no tank can ever be destroyed, whatever the algorithms do.
+     */
+    bool isOutcomeFixed() const { return outcomeFixed; }
+};
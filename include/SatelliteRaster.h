@@ -0,0 +1,164 @@
+#pragma once
+#include <vector>
+#include <memory_resource>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include "Board.h"
+#include "RasterSnapshot.h"
+#include "OccupancyGrid.h"
+#include "ShellScheduler.h"
+#include "TankTable.h"
+
+/**
+ * @class SatelliteRaster
+ * @brief The board as satellite views show it, one character per cell, shared by every
+ *        view handed out during a turn.
+ *
+ * Cells hold '#', '@', '*', '1', '2' or ' ' (tanks take precedence over shells, shells over
+ * terrain); the requesting tank's '%' is left to each view. The raster is refreshed at
+ * most once per turn, on the first battle-info request, and only the cells that can have
+ * changed are classified again: cells an entity entered since the last refresh (terrain
+ * only ever changes under an entity), cells that showed an entity at the last refresh
+ * (it may have left), and the cells of the sleeping shells, which move without touching
+ * the occupancy grid.
+ *
+ * Each refresh is numbered (its version), and the cells whose character it changed are
+ * appended to a journal, so a reader holding an older version can ask which cells changed
+ * since. The journal is bounded to a share of the board; when it fills up it is emptied
+ * and readers older than the current version have to read the whole raster again.
+ *
+ * The raster also hands out immutable snapshots (see RasterSnapshot). It keeps the rows
+ * changed since the last snapshot, a hash of its content and its count of non-blank cells
+ * up to date as cells change, so taking a snapshot never rescans the board.
+ */
+class SatelliteRaster {
+private:
+    const Board* board = nullptr;
+    const OccupancyGrid* occupancy = nullptr;
+    ShellScheduler* sleepingShells = nullptr;
+    const TankTable* tanks = nullptr;
+
+    std::pmr::vector<char> chars;          ///< View character of each cell, row-major
+    std::pmr::vector<uint64_t> dirtyPlane; ///< Cells to classify again at the next refresh (one bit per cell)
+    std::pmr::vector<size_t> dirtyWords;   ///< Words holding at least one dirty bit
+    std::pmr::vector<uint64_t> shownPlane; ///< Cells that showed an entity at the last refresh
+    std::pmr::vector<size_t> shownWords;   ///< Words holding at least one shown bit
+    bool ready = false;                    ///< Whether chars matches the current game state
+
+    static constexpr size_t JOURNAL_SHARE = 8; ///< The journal holds at most one cell in this many (plus a few)
+
+    std::pmr::vector<size_t> journalCells;      ///< Cells whose character changed, oldest refresh first
+    std::pmr::vector<uint64_t> journalVersions; ///< Refresh that changed each journaled cell
+    size_t journalCapacity = 0;                 ///< Most cells the journal holds
+    uint64_t version = 0;                       ///< Refreshes since reset (0 = none yet)
+    uint64_t journalFloor = 0;                  ///< Every change made after this version is journaled
+
+    uint64_t contentHash = 0;                   ///< XOR of the keys of the non-blank cells (see charKey)
+    size_t nonBlankCells = 0;                   ///< Cells not showing ' '
+    std::pmr::vector<uint8_t> staleRows;        ///< Whether each row changed since the last snapshot
+    std::pmr::vector<size_t> staleRowList;      ///< The rows flagged in staleRows
+    std::shared_ptr<const RasterSnapshot> latestSnapshot; ///< Last snapshot handed out (null before the first)
+
+    /**
+     * @brief Appends a changed cell to the journal, or empties it if it is full.
+     */
+    void journal(size_t cell);
+
+    /**
+     * @brief Updates the content hash, the non-blank count and the stale rows for a cell
+     *        whose character changes from before to after.
+     */
+    void recordChange(size_t cell, char before, char after);
+
+    /**
+     * @brief Returns the key a cell showing c contributes to contentHash (0 for ' ').
+     */
+    static uint64_t charKey(size_t cell, char c);
+
+    /**
+     * @brief Computes the character of a cell from the game state.
+     */
+    char classify(size_t cell) const;
+
+public:
+    /**
+     * @brief Constructs an empty raster whose arrays draw from the given memory resource.
+     */
+    explicit SatelliteRaster(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Binds the raster to the game state; the first refresh classifies every cell.
+     */
+    void reset(const Board& board, const OccupancyGrid& occupancy, ShellScheduler& sleepingShells, const TankTable& tanks);
+
+    /**
+     * @brief Records that a cell's content may have changed (an entity entered it).
+     */
+    void markDirty(size_t cell) {
+        if (dirtyPlane[cell >> 6] == 0) dirtyWords.push_back(cell >> 6);
+        dirtyPlane[cell >> 6] |= uint64_t{1} << (cell & 63);
+    }
+
+    /**
+     * @brief Declares the raster out of date (the game state is about to change).
+     */
+    void invalidate() { ready = false; }
+
+    /**
+     * @brief Brings the raster up to date with the current game state, if it is not already.
+     */
+    void refresh();
+
+    /**
+     * @brief Returns the character of a cell (refresh() must have been called this turn).
+     */
+    char at(size_t cell) const { return chars[cell]; }
+
+    /**
+     * @brief Returns the characters of row y, cols of them (refresh() must have been called this turn).
+     */
+    const char* rowData(size_t y, size_t cols) const { return chars.data() + y * cols; }
+
+    /**
+     * @brief Returns an immutable copy of the raster (refresh() must have been called this turn).
+     *        Consecutive calls without changes in between return the same snapshot.
+     */
+    std::shared_ptr<const RasterSnapshot> snapshot();
+
+    /**
+     * @brief Returns the version of the last refresh (0 before the first one).
+     */
+    uint64_t getVersion() const { return version; }
+
+    /**
+     * @brief Calls visit(cell) for every cell whose character changed after the given version
+     *        (a cell may be visited more than once).
+     * @return False, without visiting anything, if the journal no longer covers that version.
+     */
+    template <typename Visitor>
+    bool forEachChangeSince(uint64_t known, Visitor&& visit) const {
+        if (known == 0 || known < journalFloor) return false;
+        auto first = std::upper_bound(journalVersions.begin(), journalVersions.end(), known);
+        for (size_t k = static_cast<size_t>(first - journalVersions.begin()); k < journalCells.size(); ++k) {
+            visit(journalCells[k]);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Calls visit(cell, character) for every cell showing an entity ('*', '1' or '2'),
+     *        in time proportional to their number (refresh() must have been called this turn).
+     */
+    template <typename Visitor>
+    void forEachEntityCell(Visitor&& visit) const {
+        for (size_t w : shownWords) {
+            for (uint64_t bits = shownPlane[w]; bits; bits &= bits - 1) {
+                size_t cell = (w << 6) | static_cast<size_t>(std::countr_zero(bits));
+                visit(cell, chars[cell]);
+            }
+        }
+    }
+};
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include "Direction.h"
+
+/**
+ * @brief Advances packed shell coordinates one cell along their directions, wrapping
+ *        around the board edges (torus-like behavior).
+ *
+ * The arrays are parallel: shell i is at (xs[i], ys[i]) flying in dirs[i]. Every
+ * coordinate must already be inside the board. The widest kernel the CPU supports
+ * (AVX2, SSE2 or scalar) is picked once at runtime; all of them give identical results.
+ */
+void advanceShellPositions(int* xs, int* ys, const Direction* dirs, size_t count, int cols, int rows);
+
+/**
+ * @brief Signature shared by the kernel variants (same contract as advanceShellPositions).
+ */
+using ShellAdvanceKernel = void (*)(int* xs, int* ys, const Direction* dirs, size_t count, int cols, int rows);
+
+/**
+ * @brief A kernel variant compiled into the binary.
+ */
+struct ShellKernelVariant {
+    const char* name;           ///< "avx2", "sse2" or "scalar"
+    ShellAdvanceKernel advance; ///< The kernel itself
+    bool supported;             ///< Whether the running CPU can execute it
+};
+
+/**
+ * @brief Lists every compiled kernel variant, widest first. advanceShellPositions runs the
+ *        first supported one; the list lets tests check the narrower ones as well.
+ */
+std::span<const ShellKernelVariant> getShellKernels();
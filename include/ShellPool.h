@@ -0,0 +1,146 @@
+#pragma once
+#include <vector>
+#include <memory_resource>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include "Direction.h"
+
+/**
+ * @brief Stable identifier of a shell in the ShellPool (valid until the shell is released).
+ */
+using ShellHandle = uint32_t;
+
+/**
+ * @class ShellPool
+ * @brief Struct-of-arrays storage for all shells in flight.
+ *
+ * Positions and directions live in parallel dense arrays so the whole fleet can be
+ * advanced in one linear sweep. Shells are addressed either by dense slot (for sweeps)
+ * or by a stable handle (for lookups). Releasing a shell moves the last shell into its
+ * slot (swap-and-pop) and returns the handle to a free list, so steady-state firing and
+ * removal never touch the allocator.
+ *
+ * Awake shells occupy the leading slots [0, getAwakeCount()); shells put to sleep by the
+ * ShellScheduler sit after them and are skipped by advanceAwake().
+ */
+class ShellPool {
+private:
+    std::pmr::vector<int> xs;                  ///< X coordinate per dense slot
+    std::pmr::vector<int> ys;                  ///< Y coordinate per dense slot
+    std::pmr::vector<Direction> directions;    ///< Flight direction per dense slot
+    std::pmr::vector<ShellHandle> handles;     ///< Handle of the shell stored in each dense slot
+    std::pmr::vector<uint32_t> slots;          ///< Dense slot of each handle (INVALID_SLOT if released)
+    std::pmr::vector<ShellHandle> freeHandles; ///< Released handles available for reuse
+    size_t awakeCount = 0;                ///< Number of leading slots holding awake shells
+
+    /**
+     * @brief Exchanges the shells stored in two dense slots, keeping handles pointing at them.
+     */
+    void swapSlots(size_t a, size_t b);
+
+public:
+    static constexpr uint32_t INVALID_SLOT = UINT32_MAX; ///< Slot value of a released handle
+
+    /**
+     * @brief Constructs an empty pool whose arrays draw from the given memory resource.
+     */
+    explicit ShellPool(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Adds an awake shell at the given position, flying in the given direction.
+     * @return The handle of the new shell.
+     */
+    ShellHandle spawn(int x, int y, Direction dir);
+
+    /**
+     * @brief Removes a shell by swap-and-pop. Releasing an already released handle is a no-op.
+     */
+    void release(ShellHandle handle);
+
+    /**
+     * @brief Reserves room for the given number of shells and handles.
+     */
+    void reserve(size_t shellCount);
+
+    /**
+     * @brief Returns the number of shells in flight.
+     */
+    size_t size() const { return xs.size(); }
+
+    /**
+     * @brief Returns the number of awake shells (they occupy the leading dense slots).
+     */
+    size_t getAwakeCount() const { return awakeCount; }
+
+    /**
+     * @brief Checks whether a live shell is awake.
+     */
+    bool isAwake(ShellHandle handle) const { return slots[handle] < awakeCount; }
+
+    /**
+     * @brief Moves an awake shell out of the awake slots.
+     */
+    void sleep(ShellHandle handle);
+
+    /**
+     * @brief Moves a sleeping shell back into the awake slots.
+     */
+    void wake(ShellHandle handle);
+
+    /**
+     * @brief Checks whether a handle refers to a shell that is still in flight.
+     */
+    bool isAlive(ShellHandle handle) const { return handle < slots.size() && slots[handle] != INVALID_SLOT; }
+
+    /**
+     * @brief Returns the dense slot currently holding the given shell.
+     */
+    size_t getSlot(ShellHandle handle) const { return slots[handle]; }
+
+    /**
+     * @brief Returns the handle of the shell stored in a dense slot.
+     */
+    ShellHandle getHandleAt(size_t slot) const { return handles[slot]; }
+
+    /**
+     * @brief Returns the position of the shell stored in a dense slot.
+     */
+    std::pair<int, int> getPositionAt(size_t slot) const { return {xs[slot], ys[slot]}; }
+
+    /**
+     * @brief Returns the direction of the shell stored in a dense slot.
+     */
+    Direction getDirectionAt(size_t slot) const { return directions[slot]; }
+
+    /**
+     * @brief Advances every awake shell one cell along its direction, wrapping around the board.
+     */
+    void advanceAwake(int cols, int rows);
+
+    /**
+     * @brief Advances the awake shells in slots [firstSlot, lastSlot) only. Disjoint ranges
+     *        touch disjoint array elements, so they can be advanced from different threads.
+     */
+    void advanceAwake(int cols, int rows, size_t firstSlot, size_t lastSlot);
+
+    /**
+     * @brief Updates the position of the shell stored in a dense slot.
+     */
+    void setPositionAt(size_t slot, int x, int y) { xs[slot] = x; ys[slot] = y; }
+
+    /**
+     * @brief Updates the position of a live shell.
+     */
+    void setPosition(ShellHandle handle, int x, int y) { setPositionAt(slots[handle], x, y); }
+
+    /**
+     * @brief Returns the position of a live shell.
+     */
+    std::pair<int, int> getPosition(ShellHandle handle) const { return getPositionAt(slots[handle]); }
+
+    /**
+     * @brief Returns the direction of a live shell.
+     */
+    Direction getDirection(ShellHandle handle) const { return directions[slots[handle]]; }
+};
@@ -0,0 +1,137 @@
+#pragma once
+#include <vector>
+#include <memory_resource>
+#include <utility>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include "Board.h"
+#include "OccupancyGrid.h"
+#include "ShellPool.h"
+
+/**
+ * @class ShellScheduler
+ * @brief Event-driven handling of shells that cannot hit anything for a while.
+ *
+ * A shell alone on its cell looks ahead along its straight line. If the next cells hold
+ * no wall and no entity, the shell is put to sleep for that many half-steps (its event
+ * horizon). It leaves the occupancy grid and the awake part of the ShellPool, so it is
+ * neither moved nor collision-checked. Its cells are reserved instead; only one sleeping
+ * shell can reserve a given cell.
+ *
+ * A sleeping shell wakes up when its horizon is reached, or as soon as any entity enters
+ * one of its reserved cells (the only way something can meet it). Its position is then
+ * recomputed in closed form. Destroyed walls need no invalidation because they only
+ * make a horizon longer, and shells do not interact with mines.
+ *
+ * A shell sleeps for MIN_HORIZON to MAX_HORIZON half-steps. Pending wake-ups sit in a
+ * timing wheel of WHEEL_SIZE (65) buckets indexed by wake-up half-step modulo WHEEL_SIZE,
+ * so two pending wake-ups share a bucket only if they are due on the same half-step.
+ * wakeDue() empties the current half-step's bucket. Each bucket is an intrusive list
+ * threaded through per-handle links, so sleeping, waking early and waking on time are
+ * O(1) and never allocate (there is no heap of wake times).
+ */
+class ShellScheduler {
+private:
+    static constexpr uint32_t NONE = UINT32_MAX; ///< Unreserved cell marker
+    static constexpr uint32_t MIN_HORIZON = 4;   ///< Shorter horizons are not worth a sleep
+    static constexpr uint32_t MAX_HORIZON = 64;  ///< Longest look-ahead (bounds the reservation walk)
+    static constexpr uint32_t WHEEL_SIZE = MAX_HORIZON + 1; ///< Buckets needed so pending wake-ups never share one
+
+    const Board* board = nullptr;
+    OccupancyGrid* occupancy = nullptr;
+    ShellPool* shells = nullptr;
+
+    uint64_t step = 0;                    ///< Shell half-steps played so far
+    std::pmr::vector<uint32_t> reservedBy;     ///< Sleeping shell reserving each cell (NONE if free)
+    std::pmr::vector<uint64_t> sleepSteps;     ///< Half-step each sleeping shell fell asleep at
+    std::pmr::vector<uint64_t> wakeSteps;      ///< Half-step each sleeping shell must wake up at
+    std::pmr::vector<uint32_t> horizons;       ///< Number of cells reserved ahead of each sleeping shell
+    std::pmr::vector<uint32_t> wheelHeads;     ///< First sleeping shell due at each half-step (modulo WHEEL_SIZE)
+    std::pmr::vector<uint32_t> wheelNext;      ///< Next sleeping shell in the same wheel bucket
+    std::pmr::vector<uint32_t> wheelPrev;      ///< Previous sleeping shell in the same wheel bucket (NONE if head)
+
+    std::pmr::vector<uint64_t> viewPlane;      ///< Cells holding a sleeping shell, for satellite views
+    std::pmr::vector<size_t> viewWords;        ///< Words set in viewPlane
+    bool viewPlaneReady = false;          ///< Whether viewPlane matches the current half-step
+
+    /**
+     * @brief Returns where a sleeping shell is at the current half-step.
+     */
+    std::pair<int, int> currentPosition(ShellHandle handle) const;
+
+    /**
+     * @brief Clears the reservations of a sleeping shell's line.
+     */
+    void releaseLine(ShellHandle handle, uint32_t length);
+
+    /**
+     * @brief Removes a sleeping shell from its timing wheel bucket.
+     */
+    void unlinkWakeUp(ShellHandle handle);
+
+public:
+    /**
+     * @brief Constructs an empty scheduler whose arrays draw from the given memory resource.
+     */
+    explicit ShellScheduler(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Binds the scheduler to the game state and forgets all sleeping shells.
+     */
+    void reset(const Board& board, OccupancyGrid& occupancy, ShellPool& shells);
+
+    /**
+     * @brief Reserves the per-shell arrays for the given number of shell handles.
+     */
+    void reserve(size_t shellCount);
+
+    /**
+     * @brief Counts one shell half-step.
+     */
+    void advanceStep();
+
+    /**
+     * @brief Puts an awake shell to sleep if its line is clear for long enough.
+     * @return True if the shell fell asleep.
+     */
+    bool trySleep(ShellHandle handle);
+
+    /**
+     * @brief Wakes a sleeping shell: moves it to its current cell and back into the grid.
+     */
+    void wake(ShellHandle handle);
+
+    /**
+     * @brief Wakes every shell whose horizon is the current half-step.
+     */
+    void wakeDue();
+
+    /**
+     * @brief Wakes the sleeping shells whose reserved cells were entered since the
+     *        occupancy grid's changed cells were last cleared.
+     */
+    void wakeOnChangedCells();
+
+    /**
+     * @brief Builds the sleeping-shell plane used by satellite views (once per half-step).
+     */
+    void prepareViews();
+
+    /**
+     * @brief Checks whether a sleeping shell is on a cell (prepareViews() must have been called).
+     */
+    bool hasSleepingShellAt(size_t cell) const { return (viewPlane[cell >> 6] >> (cell & 63)) & 1u; }
+
+    /**
+     * @brief Calls visit(cell) for every cell holding a sleeping shell (prepareViews() must have been called).
+     */
+    template <typename Visitor>
+    void forEachSleepingShellCell(Visitor&& visit) const {
+        for (size_t w : viewWords) {
+            for (uint64_t bits = viewPlane[w]; bits; bits &= bits - 1) {
+                visit((w << 6) | static_cast<size_t>(std::countr_zero(bits)));
+            }
+        }
+    }
+};
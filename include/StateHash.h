@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+
+/**
+ * @brief Scrambles a 64-bit value (SplitMix64 finalizer). Used to derive Zobrist keys.
+ */
+inline uint64_t mixHash(uint64_t value) {
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+/**
+ * @brief Folds a value into a running hash (order-sensitive).
+ */
+inline uint64_t hashCombine(uint64_t seed, uint64_t value) {
+    return mixHash(seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)));
+}
+
+/**
+ * @brief Packs a board position into one word of a full state (see StateHashable::appendState).
+ */
+inline uint64_t packPosition(std::pair<int, int> position) {
+    return static_cast<uint32_t>(position.first) | (static_cast<uint64_t>(static_cast<uint32_t>(position.second)) << 32);
+}
+
+/**
+ * @brief Folds a board position into a running hash.
+ */
+inline uint64_t hashCombine(uint64_t seed, std::pair<int, int> position) {
+    return hashCombine(hashCombine(seed, static_cast<uint32_t>(position.first)), static_cast<uint32_t>(position.second));
+}
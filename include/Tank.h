@@ -1,38 +1,68 @@
 #pragma once
 
 #include "Direction.h"
-#include "Shell.h"
-#include "Entity.h"
+#include "ShellPool.h"
+#include "TankTable.h"
 #include "Board.h"
 
-#include <set>
 #include <utility>
-#include <iostream>
 
 /**
  * @class Tank
  * @brief Represents a player's tank on the board.
  * 
  * A tank can move, rotate, shoot shells, and manage cooldowns and backward delays.
+ * Tank is a lightweight handle onto one row of a TankTable, which owns the state;
+ * it is cheap to copy and stays valid as long as the table does.
  */
-class Tank : public Entity {
+class Tank {
 private:
-    int player; ///< Player ID (1 or 2)
-    int ammo; ///< Current ammunition
-    int tankId; ///< The tanks serial number
-    bool isAlive = true; ///< True if alive, False if dead
-    int shootCooldown = 0; ///< Turns remaining until tank can shoot again
-    int backwardDelay = -2; ///< Counter for backward movement delay
+    TankTable* table; ///< Table holding the tank's state
+    size_t index;     ///< Row of the tank in the table
 
 public:
     /**
-     * @brief Constructs a tank at a given position and direction.
-     * @param dir Initial facing direction
-     * @param x Initial x coordinate
-     * @param y Initial y coordinate
-     * @param player Player ID owning the tank
+     * @brief Constructs a handle to the tank stored at the given row of a table.
+     * @param table Table holding the tank's state
+     * @param index Row of the tank in the table
      */
-    Tank(Direction dir, int x, int y, int player, int ammo, int id);
+    Tank(TankTable& table, size_t index) : table(&table), index(index) {}
+
+    /**
+     * @brief Returns the row of the tank in its table.
+     */
+    size_t getIndex() const { return index; }
+
+    /**
+     * @brief Gets the current direction the tank is facing.
+     */
+    Direction getDirection() const;
+
+    /**
+     * @brief Returns the current position of the tank on the board.
+     */
+    std::pair<int, int> getPosition() const;
+
+    /**
+     * @brief Updates the tank's position.
+     * @param newX New X coordinate
+     * @param newY New Y coordinate
+     */
+    void setPosition(int newX, int newY);
+
+    /**
+     * @brief Returns the next position the tank would move to (with wraparound).
+     * @param board Reference to board (for wrapping)
+     * @return Wrapped (x, y) position one step forward in current direction.
+     */
+    std::pair<int, int> getNextPosition(const Board& board) const;
+
+    /**
+     * @brief Returns the previous position the tank would move to (with wraparound).
+     * @param board Reference to board (for wrapping)
+     * @return Wrapped (x, y) position one step back in current direction.
+     */
+    std::pair<int, int> getPrevPosition(const Board& board) const;
 
     /**
      * @brief Sets the direction the tank is facing.
@@ -55,11 +85,6 @@ public:
      */
     int getPlayer() const;
 
-    /**
-     * @brief Returns the type of entity ("Tank").
-     */
-    std::string getType() const override;
-
     /**
      * @brief Returns the current amount of ammo the tank has.
      */
@@ -67,9 +92,10 @@ public:
 
     /**
      * @brief Shoots a shell in the tank's facing direction, decreases ammo.
-     * @return Pointer to the newly created Shell.
+     * @param shells Pool the new shell is spawned into.
+     * @return Handle of the newly spawned shell.
      */
-    Shell* shoot();
+    ShellHandle shoot(ShellPool& shells);
 
     /**
      * @brief Starts a 4-turn cooldown after shooting.
@@ -133,7 +159,7 @@ public:
     void setBackwardDelay(int x);
 
     /**
-     * @brief Marks the tank as dead (not alive).
+     * @brief Marks the tank as dead (clears its alive bit).
      */
     void markAsDead();
 
@@ -0,0 +1,132 @@
+#pragma once
+#include <coroutine>
+#include <memory>
+#include <memory_resource>
+#include <cstddef>
+#include <utility>
+#include "ActionRequest.h"
+#include "TankAlgorithm.h"
+
+/**
+ * @brief Awaited by a TankStrategy coroutine to ask for battle info: the turn's action is
+ *        GetBattleInfo, and the coroutine resumes on the next turn, after the update.
+ */
+struct BattleInfoUpdate {};
+
+/**
+ * @class TankStrategy
+ * @brief Runs a tank's decision logic written as a coroutine, one action per resume.
+ *
+ * A strategy is a coroutine returning TankStrategy that loops over turns: it ends each
+ * turn with either `co_yield action;` or `co_await BattleInfoUpdate{};`, and next() resumes
+ * it to get the following turn's action. The frame is allocated once, when the coroutine
+ * is created, from a memory resource passed as the `std::allocator_arg_t,
+ * std::pmr::memory_resource*` arguments (after the algorithm, for a member coroutine of a
+ * TankAlgorithm); resuming never allocates.
+ */
+class TankStrategy {
+public:
+    /**
+     * @brief Coroutine promise: keeps the last decided action.
+     */
+    struct promise_type {
+        ActionRequest current = ActionRequest::DoNothing; ///< Action of the turn the coroutine stopped at
+
+        TankStrategy get_return_object() { return TankStrategy(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        std::suspend_always yield_value(ActionRequest action) noexcept {
+            current = action;
+            return {};
+        }
+        std::suspend_always await_transform(BattleInfoUpdate) noexcept {
+            current = ActionRequest::GetBattleInfo;
+            return {};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() { throw; }
+
+        /**
+         * @brief Allocates the frame of a free-function strategy from the given resource.
+         */
+        static void* operator new(size_t size, std::allocator_arg_t, std::pmr::memory_resource* frames) {
+            return allocateFrame(size, frames);
+        }
+
+        /**
+         * @brief Allocates the frame of a tank algorithm's member strategy from the given resource.
+         */
+        static void* operator new(size_t size, TankAlgorithm&, std::allocator_arg_t, std::pmr::memory_resource* frames) {
+            return allocateFrame(size, frames);
+        }
+
+        /**
+         * @brief Returns the frame to the resource it came from (stored right after it).
+         */
+        static void operator delete(void* frame, size_t size) {
+            std::pmr::memory_resource* frames = *resourceSlot(frame, size);
+            frames->deallocate(frame, paddedSize(size) + sizeof(frames), alignof(std::max_align_t));
+        }
+
+        /**
+         * @brief Placement form matching the free-function operator new.
+         */
+        static void operator delete(void* frame, size_t size, std::allocator_arg_t, std::pmr::memory_resource*) {
+            operator delete(frame, size);
+        }
+
+        /**
+         * @brief Placement form matching the member operator new.
+         */
+        static void operator delete(void* frame, size_t size, TankAlgorithm&, std::allocator_arg_t, std::pmr::memory_resource*) {
+            operator delete(frame, size);
+        }
+
+    private:
+        /** @brief Rounds a frame size up so the resource pointer after it is aligned. */
+        static size_t paddedSize(size_t size) {
+            constexpr size_t align = alignof(std::pmr::memory_resource*);
+            return (size + align - 1) / align * align;
+        }
+
+        /** @brief Returns where the resource of a frame is remembered. */
+        static std::pmr::memory_resource** resourceSlot(void* frame, size_t size) {
+            return reinterpret_cast<std::pmr::memory_resource**>(static_cast<std::byte*>(frame) + paddedSize(size));
+        }
+
+        /** @brief Allocates a frame plus room to remember its resource. */
+        static void* allocateFrame(size_t size, std::pmr::memory_resource* frames) {
+            void* frame = frames->allocate(paddedSize(size) + sizeof(frames), alignof(std::max_align_t));
+            *resourceSlot(frame, size) = frames;
+            return frame;
+        }
+    };
+
+    TankStrategy(TankStrategy&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+    TankStrategy& operator=(TankStrategy&& other) noexcept {
+        if (this != &other) {
+            if (handle) handle.destroy();
+            handle = std::exchange(other.handle, {});
+        }
+        return *this;
+    }
+    ~TankStrategy() {
+        if (handle) handle.destroy();
+    }
+
+    /**
+     * @brief Runs the strategy up to the end of its next turn and returns that turn's action.
+     *        A strategy that returned keeps answering DoNothing.
+     */
+    ActionRequest next() {
+        if (handle.done()) return ActionRequest::DoNothing;
+        handle.resume();
+        if (handle.done()) return ActionRequest::DoNothing;
+        return handle.promise().current;
+    }
+
+private:
+    explicit TankStrategy(std::coroutine_handle<promise_type> h) : handle(h) {}
+
+    std::coroutine_handle<promise_type> handle; ///< The suspended strategy (owned)
+};
@@ -0,0 +1,125 @@
+#pragma once
+#include <vector>
+#include <memory_resource>
+#include <memory>
+#include <utility>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include "Direction.h"
+#include "TankAlgorithm.h"
+
+/**
+ * @class TankTable
+ * @brief Struct-of-arrays storage for every tank in the game.
+ *
+ * Tank state (position, direction, ammo, cooldown, backward delay, owner) lives in
+ * parallel arrays indexed by tank index, i.e. the order in which tanks were placed.
+ * The controlling algorithms sit in a parallel array indexed the same way. An alive
+ * bitmask lets turn loops skip dead tanks 64 at a time, and a running count of live
+ * tanks with ammo left makes the out-of-ammo check O(1). The movement and shooting
+ * rules for a single tank are implemented by Tank, a lightweight handle onto one row.
+ */
+class TankTable {
+private:
+    friend class Tank;
+
+    std::pmr::vector<int> xs;                 ///< X coordinate per tank
+    std::pmr::vector<int> ys;                 ///< Y coordinate per tank
+    std::pmr::vector<Direction> directions;   ///< Cannon direction per tank
+    std::pmr::vector<int> ammoCounts;         ///< Remaining shells per tank
+    std::pmr::vector<int> shootCooldowns;     ///< Turns until each tank can shoot again
+    std::pmr::vector<int> backwardDelays;     ///< Backward movement delay counter per tank
+    std::pmr::vector<uint8_t> players;        ///< Owning player ID (1 or 2) per tank
+    std::pmr::vector<uint64_t> aliveMask;     ///< Bit i is set while tank i is alive
+    size_t armedCount = 0;               ///< Live tanks with ammo left
+    std::pmr::vector<std::unique_ptr<TankAlgorithm>> algorithms; ///< Controlling algorithm per tank
+
+public:
+    /**
+     * @brief Constructs an empty table whose arrays draw from the given memory resource.
+     */
+    explicit TankTable(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /**
+     * @brief Appends a live tank with no shooting cooldown and no pending backward move.
+     * @return The index of the new tank.
+     */
+    size_t add(int x, int y, Direction dir, int player, int ammo, std::unique_ptr<TankAlgorithm> algorithm);
+
+    /**
+     * @brief Returns the number of tanks, dead ones included.
+     */
+    size_t size() const { return xs.size(); }
+
+    /**
+     * @brief Checks whether a tank is alive.
+     */
+    bool isAlive(size_t index) const { return (aliveMask[index >> 6] >> (index & 63)) & 1u; }
+
+    /**
+     * @brief Clears the alive bit of a tank (a tank that still had ammo leaves the armed count).
+     */
+    void markAsDead(size_t index) {
+        if (isAlive(index) && ammoCounts[index] > 0) --armedCount;
+        aliveMask[index >> 6] &= ~(uint64_t{1} << (index & 63));
+    }
+
+    /**
+     * @brief Returns the number of live tanks that still have ammo.
+     */
+    size_t getArmedCount() const { return armedCount; }
+
+    /**
+     * @brief Returns the algorithm controlling a tank.
+     */
+    TankAlgorithm& getAlgorithm(size_t index) { return *algorithms[index]; }
+
+    /**
+     * @brief Returns the position of a tank.
+     */
+    std::pair<int, int> getPosition(size_t index) const { return {xs[index], ys[index]}; }
+
+    /**
+     * @brief Returns the direction a tank is facing.
+     */
+    Direction getDirection(size_t index) const { return directions[index]; }
+
+    /**
+     * @brief Returns the player ID that owns a tank.
+     */
+    int getPlayer(size_t index) const { return players[index]; }
+
+    /**
+     * @brief Returns the remaining ammo of a tank.
+     */
+    int getAmmo(size_t index) const { return ammoCounts[index]; }
+
+    /**
+     * @brief Returns a Zobrist-style hash of the live tanks: the XOR of one key per live
+     *        tank, derived from its index and every column of its row.
+     */
+    uint64_t getStateHash() const;
+
+    /**
+     * @brief Appends the alive mask and every column of each live tank's row to out.
+     */
+    void appendState(std::vector<uint64_t>& out) const;
+
+    /**
+     * @brief Calls visit(index) for every live tank in increasing index order.
+     *        Stops early and returns true as soon as visit returns true.
+     */
+    template <typename Visitor>
+    bool forEachAlive(Visitor&& visit) const {
+        for (size_t w = 0; w < aliveMask.size(); ++w) {
+            uint64_t pending = aliveMask[w];
+            while (pending) {
+                size_t index = (w << 6) | static_cast<size_t>(std::countr_zero(pending));
+                pending &= pending - 1;
+                if (visit(index)) return true;
+            }
+        }
+        return false;
+    }
+};
@@ -0,0 +1,81 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class ThreadPool
+ * @brief Fixed set of worker threads that run parallel loops for the game manager.
+ *
+ * parallelFor(count, body) calls body(i) once for every i in [0, count) and returns once
+ * all calls are done. The calling thread takes part, so a pool of N threads starts N - 1
+ * workers. Indices are handed out one at a time, which suits a few expensive items (one
+ * per tank). No memory is allocated per loop.
+ */
+class ThreadPool {
+private:
+    using Task = void (*)(void* context, size_t index);
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wakeWorkers;  ///< Signals a new loop (or shutdown) to the workers
+    std::condition_variable loopDone;     ///< Signals the caller that every worker finished the loop
+    uint64_t generation = 0;              ///< Number of loops started, lets workers spot a new one
+    size_t busyWorkers = 0;               ///< Workers still running the current loop
+    bool stopping = false;
+
+    Task task = nullptr;                  ///< Body of the current loop
+    void* context = nullptr;              ///< Argument passed to task
+    size_t count = 0;                     ///< Number of indices of the current loop
+    std::atomic<size_t> nextIndex{0};     ///< Next index to hand out
+
+    /**
+     * @brief Runs a type-erased loop on all threads and waits for it to finish.
+     */
+    void run(size_t loopCount, Task loopTask, void* loopContext);
+
+    /**
+     * @brief Claims and runs indices of the current loop until none are left.
+     */
+    void drain();
+
+    /**
+     * @brief Main function of a worker thread.
+     */
+    void workerLoop();
+
+public:
+    /**
+     * @brief Starts threadCount - 1 workers (the calling thread is the last one).
+     */
+    explicit ThreadPool(size_t threadCount);
+
+    /**
+     * @brief Stops and joins the workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Calls body(i) for every i in [0, loopCount), spread over the threads, and
+     *        returns when all calls are done. Calls may run in any order.
+     */
+    template <typename Body>
+    void parallelFor(size_t loopCount, Body&& body) {
+        using BodyType = std::remove_reference_t<Body>;
+        run(loopCount, [](void* ctx, size_t index) { (*static_cast<BodyType*>(ctx))(index); },
+            const_cast<void*>(static_cast<const void*>(&body)));
+    }
+
+    /**
+     * @brief Returns the number of threads taking part in a loop (workers plus the caller).
+     */
+    size_t getThreadCount() const { return workers.size() + 1; }
+};
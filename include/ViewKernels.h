@@ -0,0 +1,48 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "ObjectType.h"
+
+/**
+ * @brief Bit masks of the interesting characters of a classified row: bit x of word
+ *        x / 64 is set when character x is one. Each array holds (count + 63) / 64 words.
+ */
+struct ViewRowMasks {
+    uint64_t* shells;  ///< Characters classified as ObjectType::Shell ('*')
+    uint64_t* self;    ///< The requesting tank's '%' characters
+    uint64_t* enemies; ///< Characters classified as ObjectType::EnemyTank
+};
+
+/**
+ * @brief Classifies a row of satellite-view characters into ObjectType values for the
+ *        given player, as MyBattleInfo does ('%' and the player's own digit are AllyTank,
+ *        the other digit EnemyTank, '?' Unknown, unrecognized characters Empty), and fills
+ *        the masks.
+ *
+ * The character is hashed to a 4-bit index (low nibble XOR a per-high-nibble value),
+ * which selects both the expected character and its type in 16-entry tables, so the
+ * vector kernels classify with byte shuffles. The widest kernel the CPU supports (AVX2,
+ * SSSE3 or scalar) is picked once at runtime; all of them give identical results.
+ */
+void classifyViewRow(const char* chars, size_t count, int playerIndex, ObjectType* types, const ViewRowMasks& masks);
+
+/**
+ * @brief Signature shared by the kernel variants (same contract as classifyViewRow).
+ */
+using ViewClassifyKernel = void (*)(const char* chars, size_t count, int playerIndex, ObjectType* types, const ViewRowMasks& masks);
+
+/**
+ * @brief A kernel variant compiled into the binary.
+ */
+struct ViewKernelVariant {
+    const char* name;            ///< "avx2", "ssse3" or "scalar"
+    ViewClassifyKernel classify; ///< The kernel itself
+    bool supported;              ///< Whether the running CPU can execute it
+};
+
+/**
+ * @brief Lists every compiled kernel variant, widest first. classifyViewRow runs the first
+ *        supported one; the list lets tests check the narrower ones as well.
+ */
+std::span<const ViewKernelVariant> getViewKernels();
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/**
+ * @struct ViewWindow
+ * @brief The part of the board a satellite view shows: every cell within radius steps of the
+ *        center along both axes, wrapping around the board edges like tank movement does.
+ *
+ * The default window is unlimited. A window at least as wide (or high) as the board covers
+ * every column (or row).
+ */
+struct ViewWindow {
+    static constexpr size_t UNLIMITED = SIZE_MAX;
+
+    std::pair<int, int> center = {0, 0}; ///< Cell the window is centered on (the requesting tank)
+    size_t radius = UNLIMITED;            ///< Steps visible on each side of the center
+
+    /**
+     * @brief Checks whether the window spans a whole board axis of the given length.
+     */
+    bool spans(size_t length) const { return radius >= length / 2; }
+
+    /**
+     * @brief Checks whether the window covers the whole board.
+     */
+    bool coversBoard(size_t rows, size_t cols) const { return spans(rows) && spans(cols); }
+
+    /**
+     * @brief Checks whether coordinate a lies within radius of c on an axis of the given length.
+     */
+    bool withinAxis(size_t a, int c, size_t length) const {
+        if (spans(length)) return true;
+        size_t from = static_cast<size_t>(c);
+        size_t distance = a >= from ? a - from : a + length - from;
+        return distance <= radius || length - distance <= radius;
+    }
+
+    /**
+     * @brief Checks whether an in-bounds cell lies inside the window.
+     */
+    bool contains(size_t x, size_t y, size_t rows, size_t cols) const {
+        return withinAxis(x, center.first, cols) && withinAxis(y, center.second, rows);
+    }
+};
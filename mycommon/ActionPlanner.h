@@ -0,0 +1,28 @@
+#pragma once
+#include <cstddef>
+#include "ActionRequest.h"
+
+/**
+ * @class ActionPlanner
+ * @brief Optional interface for tank algorithms that can commit to their next few actions.
+ *
+ * An algorithm that decides from nothing but its own state (changed only by its own
+ * decisions and by updateBattleInfo) knows today which actions it will return on the
+ * following turns, up to its next GetBattleInfo. The game manager asks such an algorithm
+ * for the whole plan at once and plays it back turn by turn, instead of calling getAction
+ * every turn. The plan ends at the first GetBattleInfo because the update it triggers is
+ * the only event that can change the algorithm's later decisions.
+ */
+class ActionPlanner {
+public:
+    virtual ~ActionPlanner() = default;
+
+    /**
+     * @brief Writes the actions getAction would return on the next turns, in order.
+     * @param out Buffer receiving the plan.
+     * @param maxActions Capacity of out (at least 1).
+     * @return Number of actions written: at least 1, stopping after the first GetBattleInfo.
+     *         The algorithm's state afterwards is the state after that many getAction calls.
+     */
+    virtual size_t planActions(ActionRequest* out, size_t maxActions) = 0;
+};
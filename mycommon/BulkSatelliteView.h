@@ -0,0 +1,22 @@
+#pragma once
+#include <cstddef>
+
+/**
+ * @class BulkSatelliteView
+ * @brief Optional interface for satellite views that can hand out a whole row at once.
+ *
+ * A view that keeps its characters in a row-major raster can copy a row in one go instead
+ * of answering one getObjectAt call per cell. Readers discover the capability with a
+ * dynamic_cast and fall back to getObjectAt for views that do not implement it.
+ */
+class BulkSatelliteView {
+public:
+    virtual ~BulkSatelliteView() = default;
+
+    /**
+     * @brief Writes getObjectAt(x, y) for every x in [0, cols) of row y to out.
+     * @param y Row index (0-based).
+     * @param out Buffer of at least cols characters.
+     */
+    virtual void copyRow(size_t y, char* out) const = 0;
+};
@@ -0,0 +1,26 @@
+#pragma once
+#include <utility>
+#include <vector>
+
+/**
+ * @class DeltaSatelliteView
+ * @brief Optional interface for satellite views that know what the requesting tank saw last.
+ *
+ * Between two battle-info requests of a tank only a handful of cells change. A view that
+ * tracks the last view handed to the tank can list the cells whose getObjectAt may differ
+ * from it, so the reader only needs to look at those. Readers discover the capability with
+ * a dynamic_cast; a view that cannot tell (first request, or too much changed) says so and
+ * the whole board has to be read.
+ */
+class DeltaSatelliteView {
+public:
+    virtual ~DeltaSatelliteView() = default;
+
+    /**
+     * @brief Replaces the contents of out with the cells that may have changed since the view
+     *        the requesting tank received last (a cell may be listed more than once).
+     * @param out Receives the cells, in no particular order.
+     * @return False if no such list is available and the whole board must be read.
+     */
+    virtual bool listChangedCells(std::vector<std::pair<int, int>>& out) const = 0;
+};
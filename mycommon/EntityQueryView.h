@@ -0,0 +1,41 @@
+#pragma once
+#include <utility>
+#include <vector>
+
+/**
+ * @struct TankSighting
+ * @brief A tank as a satellite view shows it.
+ */
+struct TankSighting {
+    std::pair<int, int> position; ///< Cell (x, y) the tank is shown on
+    int owner;                    ///< Player digit shown for the tank (1 or 2)
+    bool self;                    ///< Whether the view shows the tank as '%' (the requesting tank)
+};
+
+/**
+ * @class EntityQueryView
+ * @brief Optional interface for satellite views that can list their entities directly.
+ *
+ * Tanks and shells are a few dozen cells of a board that may hold millions. A view backed
+ * by the engine's entity arrays answers these queries in time proportional to the number
+ * of entities, where reading them off getObjectAt means visiting every cell. The answers
+ * agree with getObjectAt: a tank is listed where it shows a digit or '%', a shell cell is
+ * listed where it shows '*' (a shell under a tank is hidden, as on the raster). Readers
+ * discover the capability with a dynamic_cast.
+ */
+class EntityQueryView {
+public:
+    virtual ~EntityQueryView() = default;
+
+    /**
+     * @brief Replaces the contents of out with the tanks on the board.
+     * @param out Receives one entry per tank, in no particular order.
+     */
+    virtual void listTanks(std::vector<TankSighting>& out) const = 0;
+
+    /**
+     * @brief Replaces the contents of out with the cells showing a shell.
+     * @param out Receives each such cell once, in no particular order.
+     */
+    virtual void listShells(std::vector<std::pair<int, int>>& out) const = 0;
+};
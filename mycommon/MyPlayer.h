@@ -1,6 +1,9 @@
 #pragma once
 #include "Player.h"
+#include "StateHashable.h"
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 #include <iostream>
 
 /**
@@ -9,7 +12,7 @@
  * Inherits from Player and provides a common interface for user-defined players.
  * Stores player index, board size, and other configuration parameters.
  */
-class MyPlayer : public Player {
+class MyPlayer : public Player, public StateHashable {
 protected:
     int playerIndex; ///< Player index (1 or 2)
     size_t rows; ///< Number of rows on the board
@@ -44,4 +47,15 @@ public:
      * @param satellite_view The satellite view object containing information about the board.
      */
     virtual void updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satellite_view) override = 0;
+
+    /**
+     * @brief Returns the hash of the player's decision state. The configuration above never
+     *        changes, so a player that keeps nothing between calls has a constant state.
+     */
+    uint64_t stateHash() const override { return 0; }
+
+    /**
+     * @brief Appends nothing, for the same reason.
+     */
+    void appendState(std::vector<uint64_t>&) const override {}
 };
\ No newline at end of file
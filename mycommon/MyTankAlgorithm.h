@@ -6,17 +6,21 @@
 #include "BattleInfo.h"
 #include "ObjectType.h"
 #include "MyBattleInfo.h"
+#include "ObjectGrid.h"
+#include "StateHashable.h"
 #include <set>
+#include <cstdint>
 #include <vector>
 #include <utility>
 
-class MyTankAlgorithm : public TankAlgorithm {
+class MyTankAlgorithm : public TankAlgorithm, public StateHashable {
 protected:
     int playerIndex;
     int tankIndex;
     int rows;
     int cols;
-    std::vector<std::vector<ObjectType>> grid;
+    ObjectGrid grid; ///< The board as last reported, read with grid.at(x, y)
+    uint64_t gridHash = 0; ///< Hash of grid (XOR of its cells' keys, or of the snapshot's content when lazy), kept up to date by updateGrid
     std::pair<int,int> myPosition;
     Direction myDirection;
     std::set<std::pair<int, int>> shellsPositions; // positions of shells in the last grid
@@ -32,10 +36,17 @@ protected:
 
     /**
     * @brief Updates the internal board representation based on external battle info.
+    *        A delta info (see MyBattleInfo::isDelta) is applied to the current grid in place,
+    *        and a lazy one (see MyBattleInfo::isLazy) rebinds it to the info's snapshot.
     * @param info The BattleInfo object containing updated board data.
     */
     void updateGrid(BattleInfo& info);
 
+    /**
+    * @brief Returns the key a cell holding the given type contributes to gridHash.
+    */
+    static uint64_t cellHash(size_t cell, ObjectType type);
+
     /**
     * @brief Moves one step in the given direction with wrapping.
     */
@@ -67,7 +78,8 @@ protected:
     std::set<std::pair<int, int>> getThreatsAroundMe();
 
     /**
-    * @brief Returns dangerous cells around current position (e.g., mines, walls, tanks).
+    * @brief Returns dangerous cells around current position (e.g., mines, walls, tanks, and
+    *        cells outside the view window, which may hold any of them).
     * @return Set of dangerous nearby cell positions.
     */
     std::set<std::pair<int, int>> getThreatCellsAroundMe() const;
@@ -78,6 +90,12 @@ protected:
     */
     std::set<std::pair<int, int>> getCurrThreatShells();
 
+    /**
+    * @brief Checks whether the tank stands on one of the threats getThreatsAroundMe lists,
+    *        without building the threat sets.
+    */
+    bool isThreatened() const;
+
     /**
     * @brief Returns the 3x3 neighborhood deltas including center.
     */
@@ -128,6 +146,17 @@ public:
     */
     virtual void updateBattleInfo(BattleInfo& info) override = 0;
 
+    /**
+    * @brief Hashes the tank's believed position, direction, ammo, timers, known shells and grid.
+    * @return Hash of the state shared by all MyTankAlgorithm subclasses.
+    */
+    uint64_t stateHash() const override;
+
+    /**
+    * @brief Appends the members stateHash covers, with every grid cell instead of gridHash.
+    */
+    void appendState(std::vector<uint64_t>& out) const override;
+
     /**
     * @brief Destructor.
     */
@@ -0,0 +1,27 @@
+#pragma once
+#include <memory>
+#include <memory_resource>
+#include "TankAlgorithm.h"
+
+/**
+ * @class PooledTankAlgorithmFactory
+ * @brief Optional interface for tank algorithm factories that can place the algorithms'
+ *        long-lived allocations (such as coroutine frames) in memory owned by the game.
+ *
+ * The game manager looks for it on its TankAlgorithmFactory and, when found, creates every
+ * algorithm of a game through it with the game's arena. The arena outlives the algorithms
+ * and is released as a whole between games, so the frames of a game share its pages
+ * instead of each coming from the heap on its own.
+ */
+class PooledTankAlgorithmFactory {
+public:
+    virtual ~PooledTankAlgorithmFactory() = default;
+
+    /**
+     * @brief Creates a tank algorithm whose coroutine frames come from the given resource.
+     * @param player_index Index of the player (1 or 2).
+     * @param tank_index Index of the tank for this player.
+     * @param frames Resource owned by the game; it outlives the algorithm.
+     */
+    virtual std::unique_ptr<TankAlgorithm> create(int player_index, int tank_index, std::pmr::memory_resource* frames) const = 0;
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include <memory>
+#include "RasterSnapshot.h"
+#include "ViewWindow.h"
+
+/**
+ * @class SnapshotSatelliteView
+ * @brief Optional interface for satellite views that can hand out the board they show.
+ *
+ * A satellite view only lives for the duration of a battle-info request. A view backed by
+ * the engine's raster can instead give out an immutable, cheaply shared snapshot of it, so
+ * that a tank keeps the board without copying or classifying it and reads cells only when
+ * it needs them. Readers discover the capability with a dynamic_cast.
+ */
+class SnapshotSatelliteView {
+public:
+    virtual ~SnapshotSatelliteView() = default;
+
+    /**
+     * @brief Returns the raster the view shows, without the requesting tank's '%' (readers
+     *        find that tank through EntityQueryView), or null if no snapshot is offered.
+     */
+    virtual std::shared_ptr<const RasterSnapshot> snapshot() const = 0;
+
+    /**
+     * @brief Returns the part of the snapshot the reader may see (cells outside it read as '?').
+     */
+    virtual ViewWindow snapshotWindow() const = 0;
+};
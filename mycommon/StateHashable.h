@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class StateHashable
+ * @brief Optional interface for players and tank algorithms that can summarize their internal state.
+ *
+ * The game manager fast-forwards a game whose whole state repeats. That is only sound if
+ * every player and algorithm decides from nothing but that state, so cycle detection is
+ * enabled only when all of them implement this interface. Hashes find candidate repeats;
+ * the full states written by appendState confirm them, since two states may share a hash.
+ */
+class StateHashable {
+public:
+    virtual ~StateHashable() = default;
+
+    /**
+     * @brief Returns a hash of every member that can influence future decisions
+     *        (scratch buffers rebuilt on every use are left out).
+     */
+    virtual uint64_t stateHash() const = 0;
+
+    /**
+     * @brief Appends the members stateHash covers to out, in full, so that two states are
+     *        equal exactly when the words they append are.
+     */
+    virtual void appendState(std::vector<uint64_t>& out) const = 0;
+};
@@ -1,4 +1,7 @@
 #include "AggressivePlayer.h"
+#include "ChasingTankAlgorithm.h"
+#include "MySatelliteView.h"
+#include "StateHash.h"
 #include <cstddef>
 #include <iostream>
 #include <climits>
@@ -14,11 +17,19 @@ AggressivePlayer::AggressivePlayer(int player_index, size_t x, size_t y, size_t
  * @brief Updates the tank with satellite data and assigns an enemy target.
  */
 void AggressivePlayer::updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satellite_view) {
+    updateTank(tank, satellite_view);
+}
+
+/**
+ * @brief Scans the view, picks a target among the known enemies and hands both to the tank.
+ */
+template <typename Algorithm, typename View>
+void AggressivePlayer::updateTank(Algorithm& tank, const View& satellite_view) {
     MyBattleInfo info(satellite_view, playerIndex, rows, cols, numShells);
-    auto grid = info.getGrid();
 
-    auto myPosition = findMyPosition(satellite_view);
-    updateKnownEnemies(grid);
+    // The scan already located this tank and the enemies, no need to go over the board again
+    auto myPosition = info.getFirstSelfPosition();
+    updateKnownEnemies(info.getEnemyTanks());
 
     auto closestEnemy = findClosestEnemyWithFallback(myPosition);
 
@@ -28,35 +39,16 @@ void AggressivePlayer::updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteVi
     tank.updateBattleInfo(info);
 }
 
-/**
- * @brief Updates internal known enemy set from the satellite grid.
- */
-std::pair<int, int> AggressivePlayer::findMyPosition(SatelliteView& satellite_view) const {
-    for (size_t y = 0; y < rows; ++y) {
-        for (size_t x = 0; x < cols; ++x) {
-            if (satellite_view.getObjectAt(x, y) == '%') {
-                return {static_cast<int>(x), static_cast<int>(y)};
-            }
-        }
-    }
-    return {-1, -1};
-}
+template void AggressivePlayer::updateTank(TankAlgorithm&, const SatelliteView&);
+template void AggressivePlayer::updateTank(ChasingTankAlgorithm&, const MySatelliteView&);
 
 /**
- * @brief Updates the set of known enemy tank positions based on the current grid.
+ * @brief Updates the set of known enemy tank positions from the latest scan.
  * Also removes assignments to enemies that are no longer visible.
- * @param grid The current view of the board, marking positions of enemy tanks.
+ * @param enemyTanks The enemy tank positions found by the scan.
  */
-void AggressivePlayer::updateKnownEnemies(const std::vector<std::vector<ObjectType>>& grid) {
-    std::set<std::pair<int, int>> updated;
-
-    for (size_t y = 0; y < rows; ++y) {
-        for (size_t x = 0; x < cols; ++x) {
-            if (grid[y][x] == ObjectType::EnemyTank) {
-                updated.insert({static_cast<int>(x), static_cast<int>(y)});
-            }
-        }
-    }
+void AggressivePlayer::updateKnownEnemies(const std::vector<std::pair<int, int>>& enemyTanks) {
+    std::set<std::pair<int, int>> updated(enemyTanks.begin(), enemyTanks.end());
 
     knownEnemies = updated;
     for (auto it = assignedEnemies.begin(); it != assignedEnemies.end();) {
@@ -103,3 +95,31 @@ std::pair<int, int> AggressivePlayer::findClosestEnemyWithFallback(std::pair<int
     }
     return bestOverall;
 }
+
+/**
+ * @brief Hashes the enemy positions the player remembers between calls.
+ */
+uint64_t AggressivePlayer::stateHash() const {
+    uint64_t hash = hashCombine(0, knownEnemies.size());
+    for (const auto& enemy : knownEnemies) {
+        hash = hashCombine(hash, enemy);
+    }
+    for (const auto& enemy : assignedEnemies) {
+        hash = hashCombine(hash, enemy);
+    }
+    return hash;
+}
+
+/**
+ * @brief Appends both remembered position sets, each behind its size.
+ */
+void AggressivePlayer::appendState(std::vector<uint64_t>& out) const {
+    out.push_back(knownEnemies.size());
+    for (const auto& enemy : knownEnemies) {
+        out.push_back(packPosition(enemy));
+    }
+    out.push_back(assignedEnemies.size());
+    for (const auto& enemy : assignedEnemies) {
+        out.push_back(packPosition(enemy));
+    }
+}
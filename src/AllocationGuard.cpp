@@ -0,0 +1,54 @@
+#include "AllocationGuard.h"
+
+#ifdef TANKS_ALLOC_GUARD
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<size_t> allocationCount{0}; ///< Counted allocations of all threads
+thread_local int pauseDepth = 0;        ///< Number of live Pause objects on this thread
+
+/**
+ * @brief Allocates a block, counting it unless counting is paused on this thread.
+ */
+void* countedAllocate(size_t size, size_t alignment) {
+    if (pauseDepth == 0) allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (size == 0) size = 1;
+    void* block = alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__
+        ? std::malloc(size)
+        : std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    if (!block) throw std::bad_alloc();
+    return block;
+}
+}
+
+/**
+ * @brief Returns the number of counted allocations made by all threads so far.
+ */
+size_t AllocationGuard::getCount() { return allocationCount.load(std::memory_order_relaxed); }
+
+/**
+ * @brief Pauses counting on the calling thread.
+ */
+AllocationGuard::Pause::Pause() { ++pauseDepth; }
+
+/**
+ * @brief Resumes counting once the outermost pause ends.
+ */
+AllocationGuard::Pause::~Pause() { --pauseDepth; }
+
+// Replacements of the global allocation functions (the nothrow forms call these)
+void* operator new(size_t size) { return countedAllocate(size, 0); }
+void* operator new[](size_t size) { return countedAllocate(size, 0); }
+void* operator new(size_t size, std::align_val_t alignment) { return countedAllocate(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) { return countedAllocate(size, static_cast<size_t>(alignment)); }
+void operator delete(void* block) noexcept { std::free(block); }
+void operator delete[](void* block) noexcept { std::free(block); }
+void operator delete(void* block, size_t) noexcept { std::free(block); }
+void operator delete[](void* block, size_t) noexcept { std::free(block); }
+void operator delete(void* block, std::align_val_t) noexcept { std::free(block); }
+void operator delete[](void* block, std::align_val_t) noexcept { std::free(block); }
+void operator delete(void* block, size_t, std::align_val_t) noexcept { std::free(block); }
+void operator delete[](void* block, size_t, std::align_val_t) noexcept { std::free(block); }
+#endif
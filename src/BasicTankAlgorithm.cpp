@@ -17,7 +17,7 @@ BasicTankAlgorithm::BasicTankAlgorithm(int playerIndex, int tankIndex)
  */
 
 void BasicTankAlgorithm::updateBattleInfo(BattleInfo& info) {
-    auto myinfo = static_cast<MyBattleInfo&>(info);
+    const auto& myinfo = static_cast<const MyBattleInfo&>(info);
     myPosition = myinfo.getMyPosition();
     shellsPositions = myinfo.getShellsPositions();
     if (numShells == -1){
@@ -130,9 +130,9 @@ std::pair<int, int> BasicTankAlgorithm::findVisibleEnemyDirectionInRadius(int ra
             x += dx;
             y += dy;
             wrapPosition(x, y);
-            auto obj = grid[y][x];
+            auto obj = grid.at(x, y);
 
-            if (obj == ObjectType::Wall || obj == ObjectType::AllyTank) {
+            if (obj == ObjectType::Wall || obj == ObjectType::AllyTank || obj == ObjectType::Unknown) {
                 break;
             }
 
@@ -151,7 +151,7 @@ std::pair<int, int> BasicTankAlgorithm::findVisibleEnemyDirectionInRadius(int ra
  * Includes handling for multi-step rotations (e.g. facing backward = 180°).
  */
 ActionRequest BasicTankAlgorithm::rotateTowardTarget(int dx, int dy) {
-    Direction targetDir;
+    Direction targetDir = myDirection; // dx, dy is always one of the 8 deltas
     for (int i = 0; i < 8; ++i) {
         Direction d = static_cast<Direction>(i);
         auto delta = getDelta(d);
@@ -221,12 +221,5 @@ ActionRequest BasicTankAlgorithm::shouldGetBattleInfo() {
  * @return true if all grid cells are ObjectType::Empty, false otherwise.
  */
 bool BasicTankAlgorithm::isEmpty() const {
-    for (const auto& row : grid) {
-        for (ObjectType obj : row) {
-            if (obj != ObjectType::Empty) {
-                return false;
-            }
-        }
-    }
-    return true;
+    return grid.allEmpty();
 }
@@ -0,0 +1,81 @@
+#include "BitBoard.h"
+
+/**
+ * @brief Constructs an empty bitboard whose arrays draw from the given memory resource.
+ */
+BitBoard::BitBoard(std::pmr::memory_resource* resource)
+    : walls(resource),
+      mines(resource),
+      tanks(resource),
+      shells(resource),
+      multiTanks(resource),
+      multiShells(resource),
+      dirty(resource),
+      tankWords(resource),
+      shellWords(resource),
+      dirtyWords(resource) {}
+
+/**
+ * @brief Clears every plane and resizes them to the given number of cells.
+ */
+void BitBoard::reset(size_t cellCount) {
+    size_t words = (cellCount + 63) / 64;
+    for (std::pmr::vector<uint64_t>* plane : {&walls, &mines, &tanks, &shells, &multiTanks, &multiShells, &dirty}) {
+        plane->assign(words, 0);
+    }
+    // Each word is listed at most once, so these never outgrow the planes
+    tankWords.clear();
+    tankWords.reserve(words);
+    shellWords.clear();
+    shellWords.reserve(words);
+    dirtyWords.clear();
+    dirtyWords.reserve(words);
+}
+
+/**
+ * @brief Mirrors the terrain of a cell into the wall and mine planes.
+ */
+void BitBoard::setTerrain(size_t cell, TerrainType terrain) {
+    reset(walls, cell);
+    reset(mines, cell);
+    if (terrain == TerrainType::Wall) set(walls, cell);
+    else if (terrain == TerrainType::Mine) set(mines, cell);
+}
+
+/**
+ * @brief Zeroes the tank words written since the last clear.
+ */
+void BitBoard::clearTanks() {
+    for (size_t w : tankWords) {
+        tanks[w] = 0;
+        multiTanks[w] = 0;
+    }
+    tankWords.clear();
+}
+
+/**
+ * @brief Zeroes the shell words written since the last clear.
+ */
+void BitBoard::clearShells() {
+    for (size_t w : shellWords) {
+        shells[w] = 0;
+        multiShells[w] = 0;
+    }
+    shellWords.clear();
+}
+
+/**
+ * @brief Sets the dirty bit of a cell, remembering its word the first time it gets dirty.
+ */
+void BitBoard::markDirty(size_t cell) {
+    if (dirty[cell >> 6] == 0) dirtyWords.push_back(cell >> 6);
+    set(dirty, cell);
+}
+
+/**
+ * @brief Zeroes the dirty words.
+ */
+void BitBoard::clearDirty() {
+    for (size_t w : dirtyWords) dirty[w] = 0;
+    dirtyWords.clear();
+}
@@ -2,23 +2,17 @@
 #include "Cell.h"
 
 /**
- * @brief Constructor: initializes the grid with Cell objects at each (x, y) location.
+ * @brief Constructor: allocates one contiguous row-major array of empty cells.
  */
-Board::Board(size_t rows, size_t cols) : rows(rows), cols(cols), grid(rows) {
-    for (size_t y = 0; y < rows; ++y) {
-        grid[y].reserve(cols);
-        for (size_t x = 0; x < cols; ++x) {
-            grid[y].emplace_back(x, y); // Create Cell at (y, x)
-        }
-    }
-}
+Board::Board(size_t rows, size_t cols, std::pmr::memory_resource* resource)
+    : rows(rows), cols(cols), cells(rows * cols, resource) {}
 
 /**
  * @brief Returns a const reference to a wrapped cell at (x, y).
  */
 const Cell& Board::getCell(int x, int y) const {
     wrapPosition(x, y);
-    return grid[y][x];
+    return cells[toIndex(x, y)];
 }
 
 /**
@@ -26,7 +20,7 @@ const Cell& Board::getCell(int x, int y) const {
  */
 Cell& Board::getCell(int x, int y) {
     wrapPosition(x, y);
-    return grid[y][x];
+    return cells[toIndex(x, y)];
 }
 
 /**
@@ -51,11 +45,3 @@ int Board::getCols() const {
 int Board::getRows() const {
     return rows;
 }
-
-/**
- * @brief Wraps coordinates if they go beyond the board limits.
- */
-void Board::wrapPosition(int& x, int& y) const {
-    y = (y + rows) % rows;
-    x = (x + cols) % cols;
-}
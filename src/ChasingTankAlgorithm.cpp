@@ -1,17 +1,18 @@
 #include "ChasingTankAlgorithm.h"
+#include "StateHash.h"
 
 /**
  * @brief Constructor for the chasing tank algorithm.
  */
-ChasingTankAlgorithm::ChasingTankAlgorithm(int playerIndex, int tankIndex)
-    : MyTankAlgorithm(playerIndex, tankIndex) {}
+ChasingTankAlgorithm::ChasingTankAlgorithm(int playerIndex, int tankIndex, std::pmr::memory_resource* frames)
+    : MyTankAlgorithm(playerIndex, tankIndex), strategy(chase(std::allocator_arg, frames)) {}
 
 
 /**
  * @brief Updates the tank’s internal information based on new battle data.
  */
 void ChasingTankAlgorithm::updateBattleInfo(BattleInfo& info){
-    auto myinfo = static_cast<MyBattleInfo&>(info);
+    const auto& myinfo = static_cast<const MyBattleInfo&>(info);
     myPosition = myinfo.getMyPosition();
     lastEnemyPosition = enemyPosition;
     enemyPosition = myinfo.getEnemyPosition();
@@ -23,45 +24,116 @@ void ChasingTankAlgorithm::updateBattleInfo(BattleInfo& info){
 }
 
 /**
- * @brief Returns the next action for the tank.
- **/
-ActionRequest ChasingTankAlgorithm::getAction() {
-    UpdateShootDelay();
-    // First turn \ search for new target - get information about the game
-    if(enemyPosition.first == -1 && enemyPosition.second == -1){
-        turnsSinceLastUpdate = 1;
-        return ActionRequest::GetBattleInfo;
+ * @brief Hashes the base state plus the path being followed and the known enemy positions.
+ */
+uint64_t ChasingTankAlgorithm::stateHash() const {
+    uint64_t hash = hashCombine(MyTankAlgorithm::stateHash(), enemyPosition);
+    hash = hashCombine(hash, lastEnemyPosition);
+    for (size_t step = pathCursor; step < currentPath.size(); ++step) {
+        hash = hashCombine(hash, static_cast<uint64_t>(currentPath[step]));
     }
-    // Avoid threats
-    ActionRequest action = getThreatningNextAction(getThreatsAroundMe());
-    if (action != ActionRequest::DoNothing) {
-        updatePostAction(action);
-        turnsSinceLastUpdate++;
-        return action;
+    for (size_t step = pathCursor; step < plannedPositions.size(); ++step) {
+        hash = hashCombine(hash, plannedPositions[step]);
     }
-    // Shoot in needed
-    if(CheckIfINeedToShootX(6) == ActionRequest::Shoot){
-        if(CheckIfCanShoot()){return HandleShootRequest();}
+    return hash;
+}
+
+/**
+ * @brief Appends the base state, the known enemy positions and the rest of the path.
+ */
+void ChasingTankAlgorithm::appendState(std::vector<uint64_t>& out) const {
+    MyTankAlgorithm::appendState(out);
+    out.push_back(packPosition(enemyPosition));
+    out.push_back(packPosition(lastEnemyPosition));
+    out.push_back(currentPath.size() - pathCursor);
+    for (size_t step = pathCursor; step < currentPath.size(); ++step) {
+        out.push_back(static_cast<uint64_t>(currentPath[step]));
     }
-    // Update my info
-    if(turnsSinceLastUpdate > 3){
-        turnsSinceLastUpdate = 1;
-        return ActionRequest::GetBattleInfo;
+    out.push_back(plannedPositions.size() - std::min(pathCursor, plannedPositions.size()));
+    for (size_t step = pathCursor; step < plannedPositions.size(); ++step) {
+        out.push_back(packPosition(plannedPositions[step]));
     }
-    // Recalculate path if needed
-    if (currentPath.empty() || enemyPosition != lastEnemyPosition || myPosition != plannedPositions.front()) {
-        HandleBFS();
+}
+
+/**
+ * @brief Collects the actions up to and including the next GetBattleInfo. chase keeps
+ *        nothing across turns, so a turn's pass can be played here instead of in it.
+ */
+size_t ChasingTankAlgorithm::planActions(ActionRequest* out, size_t maxActions) {
+    size_t count = 0;
+    while (count < maxActions) {
+        int shootDelayBefore = shootDelay;
+        UpdateShootDelay();
+        if (canFollowPath()) {
+            out[count++] = ContinueAlongPath();
+            continue;
+        }
+        // The strategy runs the whole pass again, shoot delay update included
+        shootDelay = shootDelayBefore;
+        ActionRequest action = ChasingTankAlgorithm::getAction();
+        out[count++] = action;
+        if (action == ActionRequest::GetBattleInfo) break;
     }
-    // No path or reached the end — fallback to default attack or get battle information
-    if(CheckIfINeedToShootX(1) == ActionRequest::Shoot || currentPath.empty()){
-        if(CheckIfCanShoot()){return HandleShootRequest();}
+    return count;
+}
+
+/**
+ * @brief Returns the next action for the tank.
+ **/
+ActionRequest ChasingTankAlgorithm::getAction() {
+    return strategy.next();
+}
+
+/**
+ * @brief Decides one action per turn until the tank is destroyed.
+ */
+TankStrategy ChasingTankAlgorithm::chase(std::allocator_arg_t, std::pmr::memory_resource*) {
+    for (;;) {
+        UpdateShootDelay();
+        // First turn \ search for new target - get information about the game
+        if(enemyPosition.first == -1 && enemyPosition.second == -1){
+            turnsSinceLastUpdate = 1;
+            co_await BattleInfoUpdate{};
+            continue;
+        }
+        // Avoid threats
+        ActionRequest action = getThreatningNextAction(getThreatsAroundMe());
+        if (action != ActionRequest::DoNothing) {
+            updatePostAction(action);
+            turnsSinceLastUpdate++;
+            co_yield action;
+            continue;
+        }
+        // Shoot in needed
+        if(CheckIfINeedToShootX(6) == ActionRequest::Shoot && CheckIfCanShoot()){
+            co_yield HandleShootRequest();
+            continue;
+        }
+        // Update my info
+        if(turnsSinceLastUpdate > 3){
+            turnsSinceLastUpdate = 1;
+            co_await BattleInfoUpdate{};
+            continue;
+        }
+        // Recalculate path if needed
+        if (!hasPathAhead() || enemyPosition != lastEnemyPosition || myPosition != plannedPositions[pathCursor]) {
+            HandleBFS();
+        }
+        // No path or reached the end — fallback to default attack or get battle information
+        if((CheckIfINeedToShootX(1) == ActionRequest::Shoot || !hasPathAhead()) && CheckIfCanShoot()){
+            co_yield HandleShootRequest();
+            continue;
+        }
+        // Continue along the current path if it exists
+        if (hasPathAhead()) {
+            co_yield ContinueAlongPath();
+            continue;
+        }
+        // Fallback
+        enemyPosition = {-1, -1};
+        turnsSinceLastUpdate = 1;
+        co_await BattleInfoUpdate{};
     }
-    // Continue along the current path if it exists
-    if (!currentPath.empty()) {return ContinueAlongPath();}
-    // Fallback
-    enemyPosition = {-1, -1};
-    turnsSinceLastUpdate = 1;
-    return ActionRequest::GetBattleInfo;
 }
 
 /**
@@ -119,16 +191,28 @@ void ChasingTankAlgorithm::HandleBFS(){
     auto pathResult = calculatePathBFS();
     currentPath = std::move(pathResult.first);
     plannedPositions = std::move(pathResult.second);
+    pathCursor = 0;
     lastEnemyPosition = enemyPosition;
 }
 
 /**
- * @brief Performs the next action along the precomputed path.
+ * @brief Mirrors the checks chase makes before ContinueAlongPath, in the same order. Not
+ *        threatened and nothing to shoot within 6 cells also rule out the shot at 2 cells
+ *        of getThreatningNextAction and the one at 1 cell after the path check.
+ */
+bool ChasingTankAlgorithm::canFollowPath() {
+    if (enemyPosition.first == -1 && enemyPosition.second == -1) return false;
+    if (isThreatened() || CheckIfINeedToShootX(6) == ActionRequest::Shoot) return false;
+    if (turnsSinceLastUpdate > 3) return false;
+    return hasPathAhead() && enemyPosition == lastEnemyPosition && myPosition == plannedPositions[pathCursor];
+}
+
+/**
+ * @brief Performs the next action along the precomputed path (the cursor moves instead of
+ *        erasing the front, which would shift the whole path on every step).
  */
 ActionRequest ChasingTankAlgorithm::ContinueAlongPath(){
-    ActionRequest nextAction = currentPath.front();
-    currentPath.erase(currentPath.begin());
-    plannedPositions.erase(plannedPositions.begin());
+    ActionRequest nextAction = currentPath[pathCursor++];
     updatePostAction(nextAction);
     turnsSinceLastUpdate++;
     return nextAction;
@@ -142,15 +226,16 @@ ActionRequest ChasingTankAlgorithm::ContinueAlongPath(){
  * @brief Initializes the BFS queue and visited states starting from the tank's current position.
  */
 void ChasingTankAlgorithm::initializeBFS() {
-    visited = std::vector(rows, std::vector(cols, std::vector(8, false)));
+    // Reuse the buffers of the previous search instead of reallocating them
+    visited.assign(static_cast<size_t>(rows) * cols * 8, 0);
 
     auto [startX, startY] = myPosition;
     State start{startX, startY, myDirection};
-    q = std::queue<State>();
+    while (!q.empty()) q.pop();
     parent.clear();
 
     q.push(start);
-    visited[start.y][start.x][(int)start.direction] = true;
+    visitedAt(start.x, start.y, start.direction) = true;
 }
 
 /**
@@ -197,14 +282,15 @@ ChasingTankAlgorithm::reconstructPath(State current) {
  */
 void ChasingTankAlgorithm::tryMoveForward(const State& current) {
     auto [nx, ny] = moveInDirectionD(current.x, current.y, 1, current.direction);
-    ObjectType content = grid[ny][nx];
+    ObjectType content = grid.at(nx, ny);
 
     if (content != ObjectType::Wall &&
         content != ObjectType::Mine &&
         content != ObjectType::AllyTank &&
-        !visited[ny][nx][(int)current.direction]) {
+        content != ObjectType::Unknown &&
+        !visitedAt(nx, ny, current.direction)) {
         
-        visited[ny][nx][(int)current.direction] = true;
+        visitedAt(nx, ny, current.direction) = true;
         State next{nx, ny, current.direction};
         q.push(next);
         parent[next] = current;
@@ -217,8 +303,8 @@ void ChasingTankAlgorithm::tryMoveForward(const State& current) {
 void ChasingTankAlgorithm::tryAllRotations(const State& current) {
     for (auto turnFunc : {&turnLeft, &turnRight, &turnLeftQuarter, &turnRightQuarter}) {
         Direction newDir = (*turnFunc)(current.direction);
-        if (!visited[current.y][current.x][(int)newDir]) {
-            visited[current.y][current.x][(int)newDir] = true;
+        if (!visitedAt(current.x, current.y, newDir)) {
+            visitedAt(current.x, current.y, newDir) = true;
             State next{current.x, current.y, newDir};
             q.push(next);
             parent[next] = current;
@@ -0,0 +1,45 @@
+#include "CycleDetector.h"
+#include <algorithm>
+
+/**
+ * @brief Constructs an empty detector whose buffers draw from the given memory resource.
+ */
+CycleDetector::CycleDetector(std::pmr::memory_resource* resource)
+    : hashes(resource),
+      lines(resource) {}
+
+/**
+ * @brief Allocates the ring buffers up front so that recording turns never allocates.
+ */
+void CycleDetector::reset(size_t width) {
+    lineWidth = width;
+    hashes.assign(HISTORY, 0);
+    lines.assign(HISTORY * width, TurnAction{});
+    next = 0;
+    count = 0;
+}
+
+/**
+ * @brief Stores the turn, then scans the earlier turns from the most recent one.
+ */
+size_t CycleDetector::record(uint64_t hash, const TurnAction* line) {
+    hashes[next] = hash;
+    std::copy(line, line + lineWidth, lines.begin() + next * lineWidth);
+    next = (next + 1) % HISTORY;
+    count = std::min(count + 1, HISTORY);
+
+    for (size_t period = 1; period < count; ++period) {
+        if (hashes[(next + HISTORY - 1 - period) % HISTORY] == hash) {
+            return period;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Maps a future turn onto the turn it repeats among the last `period` recorded ones.
+ */
+const TurnAction* CycleDetector::getReplayLine(size_t period, size_t turn) const {
+    size_t slot = (next + HISTORY - period + turn % period) % HISTORY;
+    return lines.data() + slot * lineWidth;
+}
@@ -1,4 +1,5 @@
 #include "DefensivePlayer.h"
+#include "MySatelliteView.h"
 
 /**
  * @brief Constructs a DefensivePlayer by passing arguments to MyPlayer.
@@ -22,6 +23,17 @@ DefensivePlayer::DefensivePlayer(int player_index, size_t x, size_t y, size_t ma
  * @param satellite_view The current satellite view of the game board.
  */
 void DefensivePlayer::updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satellite_view) {
+    updateTank(tank, satellite_view);
+}
+
+/**
+ * @brief Builds the battle info from the view and hands it to the tank.
+ */
+template <typename Algorithm, typename View>
+void DefensivePlayer::updateTank(Algorithm& tank, const View& satellite_view) {
     MyBattleInfo info(satellite_view, playerIndex, rows, cols, numShells);
     tank.updateBattleInfo(info);
-} 
+}
+
+template void DefensivePlayer::updateTank(TankAlgorithm&, const SatelliteView&);
+template void DefensivePlayer::updateTank(BasicTankAlgorithm&, const MySatelliteView&); 
@@ -1,10 +1,21 @@
 #include "GameManager.h"
+#include <cassert>
+#include <cstdlib>
 
  /**
  * @brief Constructs the GameManager with factories for players and tank algorithms.
  */
-GameManager::GameManager(std::unique_ptr<PlayerFactory> pf, std::unique_ptr<TankAlgorithmFactory> tf)
-    : playerFactory(std::move(pf)), tankFactory(std::move(tf)), playerTankCount(2, 0) {}
+GameManager::GameManager(std::unique_ptr<PlayerFactory> pf, std::unique_ptr<TankAlgorithmFactory> tf, GameOptions options)
+    : shells(&arena), occupancy(&arena), bitboard(&arena), tanks(&arena), scheduler(&arena), raster(&arena), infoVersions(&arena), firedShells(&arena),
+      shellsToRemove(&arena), tanksToRemove(&arena), cycles(&arena), plans(&arena), options(options),
+      playerFactory(std::move(pf)), tankFactory(std::move(tf)), playerTankCount(2, 0) {
+    pooledFactory = dynamic_cast<const PooledTankAlgorithmFactory*>(tankFactory.get());
+    // --threads sizes the pool when given, otherwise every stripe gets its own thread
+    size_t threads = options.decisionThreads > 0 ? options.decisionThreads : options.shellStripes;
+    if (threads > 1 || options.shellStripes > 1) {
+        workerPool = std::make_unique<ThreadPool>(std::max<size_t>(threads, 1));
+    }
+}
 
 /**
  * @brief Reads and parses a board file, initializes the board and players.
@@ -29,9 +40,21 @@ bool GameManager::readBoard(const std::string& fileName) {
 
     auto rawMap = readRawMap(file);
     normalizeRawMap(rawMap);
-    board = std::make_unique<Board>(rows, cols);
+    board = std::make_unique<Board>(rows, cols, &arena);
+    occupancy.reset(board->getCellCount());
+    bitboard.reset(board->getCellCount());
+    scheduler.reset(*board, occupancy, shells);
+    raster.reset(*board, occupancy, scheduler, tanks);
     placeTerrain(rawMap);
     placeTanks(rawMap);
+    reserveTurnCapacity();
+    initStripes();
+    initActionPlans();
+    infoVersions.assign(tanks.size(), 0);
+    detectBuiltinTypes();
+    initCycleDetection();
+    outcomeFixed = options.shortCircuitFixedOutcomes && !endDependsOnShooting() &&
+                   ReachabilityAnalysis(*board, tanks).isOutcomeFixed();
     if (!inputErrors.empty()) {
         writeInputErrorsToFile();
     }
@@ -50,12 +73,16 @@ void GameManager::run(){
     bool won = false; 
     while (stepCounter < maxSteps) {
         stepCounter ++;
-        processTurn();
+        // A game whose outcome is fixed only plays its termination checks
+        if (!outcomeFixed) processTurn();
         // printBoardStateToFile();
         if (checkWinConditions()) {
             won = true;
             break;
         }
+        if (!outcomeFixed && fastForwardCycle()) {
+            break;
+        }
     }
     if (!won){
         int tankPlayer1 = playerTankCount[0];
@@ -73,44 +100,72 @@ void GameManager::run(){
      * Each player selects an action, actions are applied, and shells are moved.
 */
 void GameManager::processTurn() {
-    currentTurnActions.clear();
-    rebuildPositionMap();
-
-    size_t tankIndex = 0;
-    for (const auto& [tankPtr, algoPtr] : tankPerAlgoVector) {
-        Tank* t = tankPtr.get();
-        TankAlgorithm* algot = algoPtr.get();
-
-        if (!t->getIsAlive()) {
-            currentTurnActions.push_back("killed");
-            ++tankIndex;
-            continue;
-        }
+#ifdef TANKS_ALLOC_GUARD
+    size_t allocationsBefore = AllocationGuard::getCount();
+#endif
+    // Dead tanks keep their slot in the output line
+    currentTurnActions.assign(tanks.size(), TurnAction{});
+
+    collectActions();
+
+    // Apply in tank order, exactly as if each action had just been requested
+    tanks.forEachAlive([&](size_t i) {
+        applyAction(currentTurnActions[i].action, Tank(tanks, i), tanks.getAlgorithm(i), i);
+        return false;
+    });
 
-        ActionRequest action;
-        action = algot->getAction();
-        currentTurnActions.push_back(toString(action));
-        applyAction(action, *t, *algot, currentTurnActions.size() - 1);
-        ++tankIndex;
-    }
-    
     moveShells();
-    if (outputLog) {
-        for (size_t i = 0; i < currentTurnActions.size(); ++i) {
-            *outputLog << currentTurnActions[i];
-            if (i + 1 < currentTurnActions.size())
-                *outputLog << ", ";
-        }
-        *outputLog << std::endl;
+#ifdef TANKS_ALLOC_GUARD
+    verifyTurnAllocations(AllocationGuard::getCount() - allocationsBefore);
+#endif
+    writeTurnActions(currentTurnActions.data(), currentTurnActions.size());
+}
+
+
+/**
+ * @brief Gathers this turn's actions before any of them is applied.
+ *
+ * A tank's getAction only reads its own algorithm's state, and applying another tank's
+ * action (even GetBattleInfo, which updates only the requesting tank's algorithm) never
+ * changes it. No tank dies before the shell phase either. Asking every tank first and
+ * applying afterwards therefore gives the same actions as the interleaved serial loop.
+ */
+void GameManager::collectActions() {
+    auto decide = [this](size_t i) {
+        if (!tanks.isAlive(i)) return;
+        currentTurnActions[i] = TurnAction{nextAction(i), 0};
+    };
+    if (workerPool && options.decisionThreads > 1) {
+        workerPool->parallelFor(tanks.size(), decide);
+        return;
     }
+    for (size_t i = 0; i < tanks.size(); ++i) decide(i);
 }
 
+/**
+ * @brief Plays back the tank's plan, asking its algorithm only once the plan is used up.
+ */
+ActionRequest GameManager::nextAction(size_t i) {
+    ActionPlan& plan = plans[i];
+    if (plan.next < plan.size) return plan.actions[plan.next++];
+
+    AllocationGuard::Pause algorithmCode;
+    TankAlgorithm& algorithm = tanks.getAlgorithm(i);
+    if (!planners[i]) {
+        return builtinTypes ? BuiltinDispatch::getAction(algorithm, tanks.getPlayer(i)) : algorithm.getAction();
+    }
+    size_t planned = builtinTypes ? BuiltinDispatch::planActions(algorithm, plan.actions, PLAN_CAPACITY)
+                                  : planners[i]->planActions(plan.actions, PLAN_CAPACITY);
+    plan.size = static_cast<uint8_t>(planned);
+    plan.next = 1;
+    return plan.actions[0];
+}
 
 /**
  * @brief Applies a single action for a specific player.
  * Handles backward state if necessary.
  */
-void GameManager::applyAction(ActionRequest action, Tank& tank, TankAlgorithm& algot, size_t i) {
+void GameManager::applyAction(ActionRequest action, Tank tank, TankAlgorithm& algot, size_t i) {
 
     // Handle backward logic (may consume the entire turn)
     if (handleBackwardState(action, tank, i)) {
@@ -127,70 +182,100 @@ void GameManager::applyAction(ActionRequest action, Tank& tank, TankAlgorithm& a
 
 /**
  * @brief Moves all shells two steps with intermediate collision checks.
+ *
+ * Tanks stand still while shells fly, so the tank planes are built once for the whole
+ * phase. Each half-step is then a single sweep over the awake shells (advance, register
+ * the new cell, record the shell planes) followed by a collision sweep limited to the
+ * cells that were entered.
  */
 void GameManager::moveShells() {
-    rebuildPositionMap();
+    raster.invalidate();
+    syncOccupancy();
     HeadOnCollision();
+    rebuildTankPlanes();
     moveShellsOneStep();
-    rebuildPositionMap();
     resolveCollisions();
     moveShellsOneStep();
-    rebuildPositionMap();
     resolveCollisions();
+    sleepClearShells();
 }
 
 /**
  * @brief Moves all shells one step forward according to their direction.
  */
 void GameManager::moveShellsOneStep() {
-    for (const auto& shellPtr : shells) {
-        Shell* shell = shellPtr.get();
-        auto [nextX, nextY] = shell->getNextPosition(*board);
+    // Shells reaching the end of their clear line must take this step awake
+    scheduler.wakeDue();
+    advanceAwakeShells();
+    scheduler.advanceStep();
+
+    // The grid remembers each shell's previous cell, so only the new one is needed
+    bitboard.clearShells();
+    size_t moved = shells.getAwakeCount();
+    for (size_t slot = 0; slot < moved; ++slot) {
+        auto [x, y] = shells.getPositionAt(slot);
+        size_t cell = board->toIndex(x, y);
+        occupancy.move(EntityType::Shell, shells.getHandleAt(slot), cell);
+        bitboard.addShell(cell);
+    }
+
+    // Woken shells are appended to the awake slots, already on their current cell
+    scheduler.wakeOnChangedCells();
+    for (size_t slot = moved; slot < shells.getAwakeCount(); ++slot) {
+        auto [x, y] = shells.getPositionAt(slot);
+        bitboard.addShell(board->toIndex(x, y));
+    }
+}
 
-        // Update shell's internal position
-        shell->setPosition(nextX, nextY);
+/**
+ * @brief Puts to sleep every awake shell whose line ahead is clear (see ShellScheduler).
+ */
+void GameManager::sleepClearShells() {
+    // Walk down so that a shell swapped into the current slot was already visited
+    for (size_t slot = shells.getAwakeCount(); slot-- > 0;) {
+        scheduler.trySleep(shells.getHandleAt(slot));
     }
 }
 
 /**
  * @brief Head-on shell collision (coming from opposite directions).
+ *
+ * A tank and a shell can only share a cell at this point if one of them entered it this
+ * turn: any earlier meeting was resolved by the last collision pass. So only the cells
+ * entered since then are checked.
  */
 void GameManager::HeadOnCollision() {
-    std::set<Shell*> shellsToRemoves;
-    std::set<Tank*> tanksToRemoves;
-
-    for (const auto& [tankPtr, _] : tankPerAlgoVector) {
-        Tank* tank = tankPtr.get();
-        auto[x, y] = tank->getPosition();
-        Direction dir = tank->getDirection();
-        auto it = positionMap.find({x, y});
-
-        if (tank->getIsAlive() && it != positionMap.end()) {
-            for (Entity* ent : it->second) {
-                if (Shell* diffShell = dynamic_cast<Shell*>(ent)) {
-                    Direction oppDir = diffShell->getDirection();
+    shellsToRemove.clear();
+    tanksToRemove.clear();
+
+    for (size_t index : occupancy.getChangedCells()) {
+        occupancy.forEachAt(index, [&](Occupant tank) {
+            if (tank.type != EntityType::Tank) return false;
+            Direction dir = tanks.getDirection(tank.index);
+
+            occupancy.forEachAt(index, [&](Occupant occupant) {
+                if (occupant.type == EntityType::Shell) {
+                    Direction oppDir = shells.getDirection(occupant.index);
                     if (areOpposite(dir, oppDir)) {
-                        shellsToRemoves.insert(diffShell);
-                        tanksToRemoves.insert(tank);
-                        Cell& cell = board->getCell(x, y);
-                        if (cell.getTerrain() == TerrainType::Mine) {
-                            cell.resetMine();
+                        shellsToRemove.push_back(occupant.index);
+                        tanksToRemove.push_back(tank.index);
+                        if (board->getCellAt(index).getTerrain() == TerrainType::Mine) {
+                            detonateMine(index, terrainHash);
                         }
-                        if (cell.getTerrain() == TerrainType::Wall) {
-                            cell.incrementWallHits();
-                            if (cell.getWallHits() >= 2) {
-                                cell.resetWall();
-                            }
+                        if (board->getCellAt(index).getTerrain() == TerrainType::Wall) {
+                            hitWall(index, terrainHash);
                         }
                     }
                 }
-            }
-        }
+                return false;
+            });
+            return false;
+        });
     }
 
     // Remove all marked entities
-    removeMarkedTanks(tanksToRemoves);
-    removeMarkedShells(shellsToRemoves);
+    removeMarkedTanks(tanksToRemove);
+    removeMarkedShells(shellsToRemove);
 }
 
 
@@ -199,59 +284,129 @@ void GameManager::HeadOnCollision() {
  * Handles walls, mines, tank-tank collisions, and shell interactions.
  */
 void GameManager::resolveCollisions() {
-    std::set<Shell*> shellsToRemove;
-    std::set<Tank*> tanksToRemove;
-
-    // Iterate over all board positions with entities
-    for (auto& [pos, entities] : positionMap) {
-        if (entities.empty()) continue;
-
-        auto [localTanks, localShells] = separateEntities(entities);
-        Cell& cell = board->getCell(pos.first, pos.second);
-
-        bool removeTanks = shouldRemoveTanks(cell, localTanks, localShells);
-        bool removeShells = shouldRemoveShells(cell, localTanks, localShells);
-
-        // Mark entities for removal
-        if (removeShells) {
-            for (Shell* shell : localShells) {
-                shellsToRemove.insert(shell);
-            }
-        }
+    shellsToRemove.clear();
+    tanksToRemove.clear();
 
-        if (removeTanks) {
-            for (Tank* tank : localTanks) {
-                tanksToRemove.insert(tank);
-            }
+    // Only cells entered since the last pass can hold a new collision
+    for (size_t index : occupancy.getChangedCells()) {
+        bitboard.markDirty(index);
+        raster.markDirty(index);
+    }
+    if (stripeResults.size() <= 1) {
+        sweepCollisions(0, SIZE_MAX, shellsToRemove, tanksToRemove, terrainHash);
+    } else {
+        // Stripes are swept concurrently, then merged in stripe order
+        workerPool->parallelFor(stripeResults.size(), [this](size_t s) {
+            StripeResult& result = stripeResults[s];
+            result.shellsHit.clear();
+            result.tanksHit.clear();
+            result.terrainDelta = 0;
+            sweepCollisions(stripeBounds[s], stripeBounds[s + 1], result.shellsHit, result.tanksHit, result.terrainDelta);
+        });
+        for (const StripeResult& result : stripeResults) {
+            shellsToRemove.insert(shellsToRemove.end(), result.shellsHit.begin(), result.shellsHit.end());
+            tanksToRemove.insert(tanksToRemove.end(), result.tanksHit.begin(), result.tanksHit.end());
+            terrainHash ^= result.terrainDelta;
         }
     }
 
     // Remove all marked entities
+    occupancy.clearChangedCells();
+    bitboard.clearDirty();
     removeMarkedTanks(tanksToRemove);
     removeMarkedShells(shellsToRemove);
 }
 
 
 /**
- * @brief Rebuilds the map linking positions to their occupying entities.
+ * @brief Sweeps the dirty cells of one word range.
+ *
+ * The shell and tank planes and the occupancy grid are frozen during the sweep; the only
+ * writes are to the terrain of the visited cell and to the caller's buffers. A head-on
+ * check may read the previous cell of a shell in the neighbouring stripe (or across the
+ * wrap), which is safe for the same reason.
  */
-void GameManager::rebuildPositionMap() {
-    positionMap.clear();
+void GameManager::sweepCollisions(size_t firstWord, size_t lastWord, std::pmr::vector<ShellHandle>& shellsHit,
+                                  std::pmr::vector<size_t>& tanksHit, uint64_t& terrainDelta) {
+    bitboard.forEachCollisionIn(firstWord, lastWord, [&](size_t index, uint8_t flags) {
+        if (flags & OnMine) detonateMine(index, terrainDelta);
+        if (flags & OnWall) hitWall(index, terrainDelta);
+        if ((flags & LoneShell) && !isHeadOnHit(index)) return;
 
-    for (const auto& [tankPtr, _] : tankPerAlgoVector) {
-        Tank* tank = tankPtr.get();
-        if (tank->getIsAlive()) {
-            positionMap[tank->getPosition()].push_back(tank);
-        }
+        // Mark entities for removal
+        occupancy.forEachAt(index, [&](Occupant occupant) {
+            if (occupant.type == EntityType::Tank) {
+                if (flags & TanksHit) tanksHit.push_back(occupant.index);
+            } else {
+                shellsHit.push_back(occupant.index);
+            }
+            return false;
+        });
+    });
+}
+
+/**
+ * @brief Advances the awake shells, one slot range per stripe thread.
+ */
+void GameManager::advanceAwakeShells() {
+    size_t awake = shells.getAwakeCount();
+    size_t parts = stripeResults.size();
+    // Small fleets are not worth waking the pool for
+    if (parts <= 1 || awake < parts * MIN_SHELLS_PER_STRIPE) {
+        shells.advanceAwake(board->getCols(), board->getRows());
+        return;
     }
+    workerPool->parallelFor(parts, [&](size_t s) {
+        // Ranges start on 16-slot (64-byte) boundaries so threads never share a cache line
+        size_t first = (awake * s / parts) & ~size_t{15};
+        size_t last = (s + 1 == parts) ? awake : (awake * (s + 1) / parts) & ~size_t{15};
+        shells.advanceAwake(board->getCols(), board->getRows(), first, last);
+    });
+}
+
+/**
+ * @brief Registers the tank moves and new shells of the action phase in the occupancy grid.
+ *
+ * Satellite views handed out during the action phase must see the board as it was at the
+ * start of the turn, so the grid is only brought up to date once all actions were applied.
+ */
+void GameManager::syncOccupancy() {
+    tanks.forEachAlive([&](size_t i) {
+        auto [x, y] = tanks.getPosition(i);
+        size_t cell = board->toIndex(x, y);
+        if (cell != occupancy.getCell(EntityType::Tank, static_cast<uint32_t>(i))) {
+            occupancy.move(EntityType::Tank, static_cast<uint32_t>(i), cell);
+        }
+        return false;
+    });
 
-    for (const auto& shellPtr : shells) {
-        Shell* shell = shellPtr.get();
-        positionMap[shell->getPosition()].push_back(shell);
+    for (ShellHandle handle : firedShells) {
+        auto [x, y] = shells.getPosition(handle);
+        occupancy.insert(EntityType::Shell, handle, board->toIndex(x, y));
     }
+    firedShells.clear();
+
+    // Tanks and new shells entering a sleeping shell's line wake it up
+    scheduler.wakeOnChangedCells();
 }
 
 
+/**
+ * @brief A tank fires at most once every 4 turns (see Tank::startShootCooldown), so the one
+ *        with the most ammo fires its last shell on step 1 + 4 * (ammo - 1) at the earliest.
+ *        The zero-shells tie comes wantedCountdown steps later.
+ */
+bool GameManager::endDependsOnShooting() const {
+    if (tanks.getArmedCount() == 0) return false;
+    int maxAmmo = 0;
+    tanks.forEachAlive([&](size_t i) {
+        maxAmmo = std::max(maxAmmo, tanks.getAmmo(i));
+        return false;
+    });
+    int earliestLastShot = 1 + 4 * (maxAmmo - 1);
+    return earliestLastShot + wantedCountdown <= maxSteps;
+}
+
 /**
  * @brief Checks if the game has ended with a win, tie, or ongoing.
  */
@@ -274,13 +429,10 @@ bool GameManager::checkWinConditions(){
             return true;
         }
     }
-    bool hasAmmo = false;
-    for (const auto& [tankPtr, algoPtr] : tankPerAlgoVector) {
-        if (tankPtr->getIsAlive() && tankPtr->getAmmo() > 0){
-            hasAmmo = true;
-            break;
-        }
-    }
+#ifdef TANKS_CROSS_CHECK
+    verifyCounters();
+#endif
+    bool hasAmmo = tanks.getArmedCount() > 0;
     // Start draw countdown if both are out of ammo
     if (!hasAmmo) {
         if (drawCountdown == -1) {
@@ -296,130 +448,276 @@ bool GameManager::checkWinConditions(){
     return false;
 }
 
+/**
+ * @brief Recounts live and armed tanks with a full scan and asserts that the running counters agree.
+ */
+void GameManager::verifyCounters() const {
+    std::vector<int> liveTanks(2, 0);
+    size_t armedTanks = 0;
+    for (size_t i = 0; i < tanks.size(); ++i) {
+        if (!tanks.isAlive(i)) continue;
+        ++liveTanks[tanks.getPlayer(i) - 1];
+        if (tanks.getAmmo(i) > 0) ++armedTanks;
+    }
+    assert(liveTanks == playerTankCount && "live tank count per player drifted");
+    assert(armedTanks == tanks.getArmedCount() && "armed tank count drifted");
+}
+
+/**
+ * @brief Aborts the game if the engine allocated during a turn.
+ */
+void GameManager::verifyTurnAllocations(size_t allocations) const {
+    if (allocations > 0) {
+        std::cerr << "Allocation guard: turn " << stepCounter << " made "
+                  << allocations << " heap allocation(s)\n";
+        std::abort();
+    }
+}
+
 // ----------------------------------------------------------------
-//                RESOLVE COLLISIONS UTILITIES
+//                  CYCLE DETECTION UTILITIES
 // ----------------------------------------------------------------
 
 /**
- * @brief Removes all shells marked for deletion.
+ * @brief Collects the state views of the players and algorithms; any that cannot hash its
+ *        state disables cycle detection for the game.
  */
-void GameManager::removeMarkedShells(const std::set<Shell*>& toRemove) {
-    shells.erase(
-        std::remove_if(shells.begin(), shells.end(),
-            [&](const std::unique_ptr<Shell>& shellPtr) {
-                return toRemove.count(shellPtr.get()) > 0;
-            }),
-        shells.end()
-    );
+void GameManager::initCycleDetection() {
+    cycleDetection = true;
+    algorithmStates.assign(tanks.size(), nullptr);
+    for (size_t i = 0; i < tanks.size(); ++i) {
+        algorithmStates[i] = dynamic_cast<const StateHashable*>(&tanks.getAlgorithm(i));
+        if (!algorithmStates[i]) cycleDetection = false;
+    }
+    playerStates.assign(players.size(), nullptr);
+    for (size_t p = 0; p < players.size(); ++p) {
+        if (!players[p]) continue;
+        playerStates[p] = dynamic_cast<const StateHashable*>(players[p].get());
+        if (!playerStates[p]) cycleDetection = false;
+    }
+    cycles.reset(tanks.size());
+    pendingPeriod = 0;
 }
 
 /**
- * @brief Removes all tanks marked for deletion.
+ * @brief Looks up the ActionPlanner side of every tank algorithm.
  */
-void GameManager::removeMarkedTanks(const std::set<Tank*>& toRemove) {
-    size_t globalIndex = 0;
+void GameManager::initActionPlans() {
+    planners.assign(tanks.size(), nullptr);
+    for (size_t i = 0; i < tanks.size(); ++i) {
+        planners[i] = dynamic_cast<ActionPlanner*>(&tanks.getAlgorithm(i));
+    }
+    plans.assign(tanks.size(), ActionPlan{});
+}
 
-    for (const auto& [tankPtr, _] : tankPerAlgoVector) {
-        Tank* tank = tankPtr.get();
-        int id = tank->getPlayer();
+/**
+ * @brief Compares the dynamic type of every player and tank algorithm with the built-in one.
+ */
+void GameManager::detectBuiltinTypes() {
+    builtinTypes = true;
+    for (size_t p = 0; p < players.size(); ++p) {
+        if (players[p] && !BuiltinDispatch::matches(*players[p], static_cast<int>(p) + 1)) builtinTypes = false;
+    }
+    for (size_t i = 0; i < tanks.size(); ++i) {
+        if (!BuiltinDispatch::matches(tanks.getAlgorithm(i), tanks.getPlayer(i))) builtinTypes = false;
+    }
+}
 
-        if (toRemove.count(tank)){
-            tank->markAsDead();
-            playerTankCount[id - 1] -= 1;
+/**
+ * @brief Keys a cell by its index and packed terrain and wall damage.
+ */
+uint64_t GameManager::terrainKey(size_t index) const {
+    const Cell& cell = board->getCellAt(index);
+    if (cell.getTerrain() == TerrainType::Empty && cell.getWallHits() == 0) return 0;
+    uint64_t state = static_cast<uint64_t>(cell.getTerrain()) | (static_cast<uint64_t>(cell.getWallHits()) << 2);
+    return hashCombine(index, state);
+}
 
-            if (globalIndex < currentTurnActions.size()) { 
-                currentTurnActions[globalIndex] += " (killed)";
-            }
+/**
+ * @brief Combines the incremental terrain hash with the live tanks, their algorithms and the players.
+ */
+uint64_t GameManager::computeStateHash() const {
+    uint64_t hash = terrainHash ^ tanks.getStateHash();
+    tanks.forEachAlive([&](size_t i) {
+        // A planning algorithm is ahead of the game by the actions still waiting in its plan
+        uint64_t algorithmHash = algorithmStates[i]->stateHash();
+        const ActionPlan& plan = plans[i];
+        for (uint8_t step = plan.next; step < plan.size; ++step) {
+            algorithmHash = hashCombine(algorithmHash, static_cast<uint64_t>(plan.actions[step]));
         }
-        globalIndex++;
+        hash ^= hashCombine(i, algorithmHash);
+        return false;
+    });
+    for (size_t p = 0; p < playerStates.size(); ++p) {
+        if (playerStates[p]) hash ^= hashCombine(~uint64_t{0} - p, playerStates[p]->stateHash());
     }
+    return hash;
 }
 
 /**
- * @brief Splits a list of generic entities into two separate vectors:
- *        one containing only tanks and the other containing only shells.
+ * @brief Packs each cell's terrain and wall damage into a byte, eight cells per word, then
+ *        appends the tanks, the shell count and the state of every algorithm and player.
  */
-std::pair<std::vector<Tank*>, std::vector<Shell*>> GameManager::separateEntities(const std::vector<Entity*>& entities) {
-    std::vector<Tank*> tanks;
-    std::vector<Shell*> shells;
-    for (Entity* ent : entities) {
-        if (ent->getType() == "Tank")
-            tanks.push_back(static_cast<Tank*>(ent));
-        else if (ent->getType() == "Shell")
-            shells.push_back(static_cast<Shell*>(ent));
+void GameManager::captureState(std::vector<uint64_t>& out) const {
+    out.clear();
+    uint64_t word = 0;
+    for (size_t index = 0; index < board->getCellCount(); ++index) {
+        const Cell& cell = board->getCellAt(index);
+        uint64_t state = static_cast<uint64_t>(cell.getTerrain()) | (static_cast<uint64_t>(cell.getWallHits()) << 2);
+        word |= state << ((index & 7) * 8);
+        if ((index & 7) == 7) {
+            out.push_back(word);
+            word = 0;
+        }
+    }
+    if (board->getCellCount() & 7) out.push_back(word);
+    tanks.appendState(out);
+    out.push_back(shells.size());
+    tanks.forEachAlive([&](size_t i) {
+        const ActionPlan& plan = plans[i];
+        out.push_back(plan.size - plan.next);
+        for (uint8_t step = plan.next; step < plan.size; ++step) {
+            out.push_back(static_cast<uint64_t>(plan.actions[step]));
+        }
+        algorithmStates[i]->appendState(out);
+        return false;
+    });
+    for (const StateHashable* player : playerStates) {
+        if (player) player->appendState(out);
     }
-    return {tanks, shells};
 }
 
 /**
- * @brief Determines if the tanks in the given cell should be removed,
- *        based on the presence of shells or other game rules.
+ * @brief Fast-forwards a game whose state repeats.
+ *
+ * With no shell in flight and no draw countdown running, the state after a turn (terrain,
+ * live tanks, algorithms and players) determines every later turn. If it equals the state
+ * after an earlier turn, no tank died, fired or broke a wall in between, so no win
+ * condition can trigger and the turns in between repeat until maxSteps.
+ *
+ * Different states may share a hash, so a repeated hash only saves the full state. The game
+ * is fast-forwarded when the full state one period later equals it; the turns in between,
+ * recorded in the detector, then form the cycle.
  */
-bool GameManager::shouldRemoveTanks(Cell& cell, const std::vector<Tank*>& tanks, const std::vector<Shell*>& shells) {
-    bool remove = false;
-
-    // Mine logic: destroy any tank stepping on a mine
-    if (cell.getTerrain() == TerrainType::Mine && !tanks.empty()) {
-        cell.resetMine();
-        remove = true;
+bool GameManager::fastForwardCycle() {
+    if (!cycleDetection) return false;
+    if (shells.size() > 0 || drawCountdown != -1) {
+        cycles.forget();
+        pendingPeriod = 0;
+        return false;
     }
 
-    // Shell and tank at same location: both destroyed
-    if (!shells.empty() && !tanks.empty()) {
-        remove = true;
+    size_t period = cycles.record(computeStateHash(), currentTurnActions.data());
+    if (period == 0) return false;
+
+    int dueStep = pendingStep + static_cast<int>(pendingPeriod);
+    if (pendingPeriod != 0 && stepCounter < dueStep) return false;
+    if (period == pendingPeriod && stepCounter == dueStep) {
+        captureState(stateScratch);
+        if (stateScratch == cycleState) {
+            for (size_t turn = 0; stepCounter < maxSteps; ++turn) {
+                ++stepCounter;
+                writeTurnActions(cycles.getReplayLine(period, turn), currentTurnActions.size());
+            }
+            return true;
+        }
     }
+    // A new candidate, or a repeated hash the full states disproved: compare again one period on
+    captureState(cycleState);
+    pendingPeriod = period;
+    pendingStep = stepCounter;
+    return false;
+}
 
-    // Multiple tanks in the same cell: destroy them
-    if (tanks.size() > 1) {
-        remove = true;
-    }
+// ----------------------------------------------------------------
+//                RESOLVE COLLISIONS UTILITIES
+// ----------------------------------------------------------------
 
-    return remove;
+/**
+ * @brief Removes all shells marked for deletion (a shell may be listed more than once).
+ */
+void GameManager::removeMarkedShells(const std::pmr::vector<ShellHandle>& toRemove) {
+    for (ShellHandle handle : toRemove) {
+        if (!shells.isAlive(handle)) continue;
+        occupancy.erase(EntityType::Shell, handle);
+        shells.release(handle);
+    }
 }
 
 /**
- * @brief Determines if the shells in the given cell should be removed,
- *        typically based on collisions or interactions with tanks.
+ * @brief Removes all tanks marked for deletion.
  */
-bool GameManager::shouldRemoveShells(Cell& cell, const std::vector<Tank*>& tanks, const std::vector<Shell*>& shells) {
-    bool remove = false;
-    // Wall hit logic: 2 hits destroy the wall
-    if (cell.getTerrain() == TerrainType::Wall) {
-        cell.incrementWallHits();
-        if (cell.getWallHits() >= 2)
-            cell.resetWall();
-        remove = true;
+void GameManager::removeMarkedTanks(const std::pmr::vector<size_t>& toRemove) {
+    for (size_t index : toRemove) {
+        if (!tanks.isAlive(index)) continue;
+        tanks.markAsDead(index);
+        bitboard.removeTanks(occupancy.getCell(EntityType::Tank, static_cast<uint32_t>(index)));
+        occupancy.erase(EntityType::Tank, static_cast<uint32_t>(index));
+        playerTankCount[tanks.getPlayer(index) - 1] -= 1;
+
+        if (index < currentTurnActions.size()) { 
+            currentTurnActions[index].flags |= TurnAction::Killed;
+        }
     }
+}
 
-    // Shell and tank at same location: both destroyed
-    if (!shells.empty() && !tanks.empty()) {
-        remove = true;
-    }
+/**
+ * @brief Rebuilds the tank planes from the live tanks' cells.
+ */
+void GameManager::rebuildTankPlanes() {
+    bitboard.clearTanks();
+    tanks.forEachAlive([&](size_t i) {
+        bitboard.addTank(occupancy.getCell(EntityType::Tank, static_cast<uint32_t>(i)));
+        return false;
+    });
+}
 
-    // Multiple shells in the same cell: destroy them
-    if (shells.size() > 1) {
-        remove = true;
-    }
+/**
+ * @brief Checks whether the lone shell on a cell met a shell coming from the opposite direction.
+ */
+bool GameManager::isHeadOnHit(size_t index) const {
+    ShellHandle handle = 0;
+    occupancy.forEachAt(index, [&](Occupant occupant) {
+        handle = occupant.index;
+        return true;
+    });
+
+    Direction dir = shells.getDirection(handle);
+    auto [x, y] = shells.getPosition(handle);
+    auto [dx, dy] = getDelta(dir);
+    int prevX = x - dx;
+    int prevY = y - dy;
+    board->wrapPosition(prevX, prevY);
+    size_t prev = board->toIndex(prevX, prevY);
+    if (!bitboard.hasShell(prev)) return false;
+
+    return occupancy.forEachAt(prev, [&](Occupant occupant) {
+        return occupant.type == EntityType::Shell && areOpposite(dir, shells.getDirection(occupant.index));
+    });
+}
 
-    // Head-on shell collision (coming from opposite directions)
-    if (shells.size() == 1 && !remove){
-        Shell* shell = shells[0];
-        Direction dir = shell->getDirection();
-        auto [prevX, prevY] = shell->getPrevPosition(*board);
-        auto it = positionMap.find({prevX, prevY});
-        if (it != positionMap.end()) {
-            for (Entity* ent : it->second) {
-                if (Shell* otherShell = dynamic_cast<Shell*>(ent)) {
-                    Direction oppDir = otherShell->getDirection();
-                    if (areOpposite(dir, oppDir)) {
-                        remove = true;
-                        break;
-                    }
-                }
-            }
-        }
+/**
+ * @brief Removes the mine of a cell.
+ */
+void GameManager::detonateMine(size_t index, uint64_t& hash) {
+    hash ^= terrainKey(index);
+    board->getCellAt(index).resetMine();
+    hash ^= terrainKey(index);
+    bitboard.setTerrain(index, TerrainType::Empty);
+}
+
+/**
+ * @brief Registers a hit on the wall of a cell: 2 hits destroy the wall.
+ */
+void GameManager::hitWall(size_t index, uint64_t& hash) {
+    Cell& cell = board->getCellAt(index);
+    hash ^= terrainKey(index);
+    cell.incrementWallHits();
+    if (cell.getWallHits() >= 2) {
+        cell.resetWall();
+        bitboard.setTerrain(index, TerrainType::Empty);
     }
-    return remove;
+    hash ^= terrainKey(index);
 }
 
 
@@ -431,7 +729,7 @@ bool GameManager::shouldRemoveShells(Cell& cell, const std::vector<Tank*>& tanks
  * @brief Handles backward movement logic for a tank.
  * Cancels illegal actions, manages delay counter, and executes movement.
  */
-bool GameManager::handleBackwardState(ActionRequest action, Tank& tank, size_t i) {
+bool GameManager::handleBackwardState(ActionRequest action, Tank tank, size_t i) {
     int backwardDelay = tank.getBackwardDelay();
     // Not in backward state – treat as normal
     if (tank.notInBackwardDelay()) {
@@ -444,7 +742,7 @@ bool GameManager::handleBackwardState(ActionRequest action, Tank& tank, size_t i
             tank.resetBackwardDelay();
         }
         if (action != ActionRequest::DoNothing) {
-            currentTurnActions[i] += " (ignored)";
+            currentTurnActions[i].flags |= TurnAction::Ignored;
         }
         return true;
     }
@@ -453,7 +751,7 @@ bool GameManager::handleBackwardState(ActionRequest action, Tank& tank, size_t i
         tank.moveBackward(*board);
         tank.decreaseBackwardDelay();
         if (action != ActionRequest::DoNothing) {
-            currentTurnActions[i] += " (ignored)";
+            currentTurnActions[i].flags |= TurnAction::Ignored;
         }
         return true;
     }
@@ -475,14 +773,33 @@ bool GameManager::handleBackwardState(ActionRequest action, Tank& tank, size_t i
 /**
  * @brief Handles a normal tank action (move, rotate, shoot, wait).
  */
-void GameManager::handleNormalAction(ActionRequest action, Tank& tank, TankAlgorithm& algot, size_t i) {
+void GameManager::handleNormalAction(ActionRequest action, Tank tank, TankAlgorithm& algot, size_t i) {
     switch (action) {
         case ActionRequest::GetBattleInfo: {
             int playerIndex = tank.getPlayer();
             auto pos = tank.getPosition();
             Player& player = *players[playerIndex - 1];
-            MySatelliteView view(*board, positionMap, pos);
-            player.updateTankWithBattleInfo(algot, view);
+            raster.refresh();
+            MySatelliteView view(*board, raster, occupancy, tanks, pos);
+            if (options.viewRadius > 0) {
+                view.setWindow(ViewWindow{pos, options.viewRadius});
+            }
+            if (options.deltaBattleInfo && builtinTypes) {
+                // The built-in algorithms keep the grid of their last info and apply deltas to it
+                view.setKnownVersion(infoVersions[i]);
+                infoVersions[i] = raster.getVersion();
+            }
+            AllocationGuard::Pause playerCode;
+            if (options.lazyBattleInfo && builtinTypes) {
+                // Snapshot rows are shared with the algorithms that keep them, so making one
+                // allocates; it is done on the player's account
+                view.setSnapshot(raster.snapshot());
+            }
+            if (builtinTypes) {
+                BuiltinDispatch::updateTank(player, algot, view, playerIndex);
+            } else {
+                player.updateTankWithBattleInfo(algot, view);
+            }
             break;
         }
         case ActionRequest::MoveForward:
@@ -505,11 +822,10 @@ void GameManager::handleNormalAction(ActionRequest action, Tank& tank, TankAlgor
             break;
         case ActionRequest::Shoot:
             if (tank.canShoot()) {
-                Shell* shell = tank.shoot();
-                shells.push_back(std::unique_ptr<Shell>(shell));
+                firedShells.push_back(tank.shoot(shells));
             }
             else {
-                currentTurnActions[i] += " (ignored)";
+                currentTurnActions[i].flags |= TurnAction::Ignored;
             }
             break;
         case ActionRequest::DoNothing:
@@ -550,13 +866,29 @@ int parseIntFromLine(const std::string& line, const std::string& key) {
  * @brief Resets the game state, clearing the board, players, shells, and counters.
  */
 void GameManager::resetGameState() {
-    shells.clear();
-    positionMap.clear();
+    // Hand every arena-backed container back, then release the whole arena at once
+    board.reset();
+    shells = ShellPool(&arena);
+    tanks = TankTable(&arena);
+    occupancy = OccupancyGrid(&arena);
+    bitboard = BitBoard(&arena);
+    scheduler = ShellScheduler(&arena);
+    raster = SatelliteRaster(&arena);
+    infoVersions = std::pmr::vector<uint64_t>(&arena);
+    firedShells = std::pmr::vector<ShellHandle>(&arena);
+    cycles = CycleDetector(&arena);
+    shellsToRemove = std::pmr::vector<ShellHandle>(&arena);
+    tanksToRemove = std::pmr::vector<size_t>(&arena);
+    plans = std::pmr::vector<ActionPlan>(&arena);
+    arena.release();
+
     stepCounter = 0;
     players.clear();
     players.resize(2);
+    playerTankCount.assign(2, 0);
     winner = -1;
-    board.reset();
+    terrainHash = 0;
+    outcomeFixed = false;
 }
 
 /**
@@ -622,6 +954,8 @@ void GameManager::placeTerrain(const std::vector<std::string>& rawMap) {
                 board->getCell(x, y).setTerrain(TerrainType::Wall);
             else if (c == '@')
                 board->getCell(x, y).setTerrain(TerrainType::Mine);
+            bitboard.setTerrain(board->toIndex(x, y), board->getCell(x, y).getTerrain());
+            terrainHash ^= terrainKey(board->toIndex(x, y));
         }
     }
 }
@@ -650,16 +984,14 @@ void GameManager::placeTanks(const std::vector<std::string>& rawMap) {
                 // adjust the direction of the tank
                 Direction cannonDir = (playerIndex == 1) ? Direction::L : Direction::R;
 
-                // create the tank
-                auto tank = std::make_unique<Tank>(cannonDir, x, y, playerIndex, numShells, playerTankCount[playerIndex - 1]);
-                Tank* tankPtr = tank.get(); 
-
-                // create the tank algorithm
-                std::unique_ptr<TankAlgorithm> algorithm = tankFactory->create(playerIndex, playerTankCount[playerIndex - 1]);
+                // create the tank algorithm (with its coroutine frames in the arena if the factory can)
+                std::unique_ptr<TankAlgorithm> algorithm = pooledFactory
+                    ? pooledFactory->create(playerIndex, playerTankCount[playerIndex - 1], &arena)
+                    : tankFactory->create(playerIndex, playerTankCount[playerIndex - 1]);
 
-                // add to all relevent places
-                tankPerAlgoVector.emplace_back(std::move(tank), std::move(algorithm));
-                positionMap[{x, y}].push_back(tankPtr);
+                // create the tank and add it to all relevent places
+                size_t tank = tanks.add(x, y, cannonDir, playerIndex, numShells, std::move(algorithm));
+                occupancy.insert(EntityType::Tank, static_cast<uint32_t>(tank), board->toIndex(x, y));
 
                 // update the tank count
                 ++playerTankCount[playerIndex - 1];
@@ -671,6 +1003,42 @@ void GameManager::placeTanks(const std::vector<std::string>& rawMap) {
     }
 }
 
+/**
+ * @brief Reserves the per-turn containers: shells are bounded by the total ammo (capped, beyond
+ *        that the containers grow on demand), removal lists by the shells and tanks, and the
+ *        fired list and action line by the tanks.
+ */
+void GameManager::reserveTurnCapacity() {
+    size_t totalAmmo = tanks.size() * static_cast<size_t>(std::max(numShells, 0));
+    size_t maxShells = std::min(totalAmmo, MAX_RESERVED_SHELLS);
+    shells.reserve(maxShells);
+    occupancy.reserve(tanks.size(), maxShells);
+    scheduler.reserve(maxShells);
+    shellsToRemove.reserve(maxShells);
+    tanksToRemove.reserve(tanks.size());
+    firedShells.reserve(tanks.size());
+    currentTurnActions.reserve(tanks.size());
+}
+
+/**
+ * @brief Cuts the bitboard words into equal stripes and sizes each stripe's buffers for
+ *        the worst case, so a sweep never grows them.
+ */
+void GameManager::initStripes() {
+    size_t words = bitboard.getWordCount();
+    size_t count = std::max<size_t>(1, std::min(options.shellStripes, words));
+    stripeBounds.clear();
+    for (size_t s = 0; s <= count; ++s) stripeBounds.push_back(words * s / count);
+
+    stripeResults.clear();
+    if (count == 1) return;
+    stripeResults.resize(count);
+    for (StripeResult& result : stripeResults) {
+        result.shellsHit.reserve(shellsToRemove.capacity());
+        result.tanksHit.reserve(tanks.size());
+    }
+}
+
 /**
  * @brief Determines the game winner based on remaining players and tanks.
  */
@@ -762,6 +1130,19 @@ void GameManager::initOutputLogFromInputFile(const std::string& inputFileName) {
     ownedOutputLog = std::move(outputStream);
 }
 
+/**
+ * @brief Writes one turn's entries, comma separated, as a line of the output log.
+ */
+void GameManager::writeTurnActions(const TurnAction* actions, size_t count) {
+    if (!outputLog) return;
+    for (size_t i = 0; i < count; ++i) {
+        *outputLog << actions[i];
+        if (i + 1 < count)
+            *outputLog << ", ";
+    }
+    *outputLog << std::endl;
+}
+
 // /**
 //  * @brief Writes the current state of the board to a file named "boards_<input_suffix>.txt".
 //  * Each board snapshot includes walls, mines, tanks, and shells.
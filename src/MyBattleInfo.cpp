@@ -1,15 +1,45 @@
 #include "MyBattleInfo.h"
+#include "MySatelliteView.h"
+#include "BulkSatelliteView.h"
+#include "DeltaSatelliteView.h"
+#include "SnapshotSatelliteView.h"
+#include "ViewKernels.h"
+#include <algorithm>
+#include <bit>
+#include <type_traits>
 #include <iostream>
 
+namespace {
+
+/**
+ * @brief Returns the view as one of the optional interfaces, or nullptr if it does not
+ *        implement it (resolved at compile time when View is known to implement it).
+ */
+template <typename Interface, typename View>
+const Interface* viewAs(const View& view) {
+    if constexpr (std::is_base_of_v<Interface, View>) {
+        return &view;
+    } else {
+        return dynamic_cast<const Interface*>(&view);
+    }
+}
+
+} // namespace
+
 /**
  * @brief Constructs a BattleInfo object by analyzing the satellite view.
  *
- * This constructor scans the entire board via the provided SatelliteView and builds a grid of
- * ObjectType values. It classifies each cell based on the character returned by `getObjectAt`,
- * and fills in:
- * - The internal object grid
+ * When the view can list its entities and hand out a snapshot of the board, nothing is
+ * classified: the info is lazy (see isLazy) and the tank reads the snapshot as needed.
+ * When it can list its entities and the cells changed since the requesting tank's last
+ * view, only those cells are classified and the info is a delta (see isDelta).
+ * Otherwise this constructor reads the board row by row and builds a grid of ObjectType
+ * values. Each row's characters come from the view's copyRow when it is a BulkSatelliteView,
+ * and from `getObjectAt` otherwise; classifyViewRow then classifies the row and marks, in the
+ * same pass, the cells needed to fill in (unless the view lists its entities, which is cheaper):
  * - The shell positions
  * - The position of the calling tank (`myPosition`)
+ * - The enemy tanks
  * 
  * @param view Reference to a SatelliteView for global board access
  * @param playerIndex The player index (1 or 2) of the calling tank
@@ -17,37 +47,107 @@
  * @param cols Number of columns on the board
  * @param numShells The number of shells the tank has (copied into the info)
  */
-MyBattleInfo::MyBattleInfo(const SatelliteView& view, int playerIndex, size_t rows, size_t cols, int numShells)
-    : grid(rows, std::vector<ObjectType>(cols, ObjectType::Empty)),
-    numShells(numShells) {
+template <typename View>
+MyBattleInfo::MyBattleInfo(const View& view, int playerIndex, size_t rows, size_t cols, int numShells)
+    : playerIndex(playerIndex), numShells(numShells) {
+    const BulkSatelliteView* bulk = viewAs<BulkSatelliteView>(view);
+    const EntityQueryView* query = viewAs<EntityQueryView>(view);
+    const DeltaSatelliteView* changes = viewAs<DeltaSatelliteView>(view);
+    const SnapshotSatelliteView* snapshots = viewAs<SnapshotSatelliteView>(view);
+
+    if (query && snapshots && (snapshot = snapshots->snapshot())) {
+        window = snapshots->snapshotWindow();
+        recordEntities(*query, playerIndex, cols);
+        return;
+    }
+
+    if (query && changes && changes->listChangedCells(changedCells)) {
+        delta = true;
+        std::vector<char> chars(changedCells.size());
+        for (size_t k = 0; k < changedCells.size(); ++k) {
+            chars[k] = view.getObjectAt(static_cast<size_t>(changedCells[k].first), static_cast<size_t>(changedCells[k].second));
+        }
+        // The changed cells are classified as one row; its masks are not needed
+        size_t words = (chars.size() + 63) / 64;
+        std::vector<uint64_t> maskWords(words * 3);
+        ViewRowMasks masks{maskWords.data(), maskWords.data() + words, maskWords.data() + 2 * words};
+        changedTypes.resize(chars.size());
+        classifyViewRow(chars.data(), chars.size(), playerIndex, changedTypes.data(), masks);
+        recordEntities(*query, playerIndex, cols);
+        return;
+    }
+
+    grid.assign(rows, std::vector<ObjectType>(cols, ObjectType::Empty));
+    std::vector<char> row(cols);
+    size_t words = (cols + 63) / 64;
+    std::vector<uint64_t> maskWords(words * 3);
+    ViewRowMasks masks{maskWords.data(), maskWords.data() + words, maskWords.data() + 2 * words};
+
     for (size_t y = 0; y < rows; ++y) {
-        for (size_t x = 0; x < cols; ++x) {
-            char c = view.getObjectAt(x, y);
-            ObjectType type = ObjectType::Empty;
-
-            switch (c) {
-                case '1':
-                    type = (playerIndex == 1) ? ObjectType::AllyTank : ObjectType::EnemyTank;
-                    break;
-                case '2':
-                    type = (playerIndex == 2) ? ObjectType::AllyTank : ObjectType::EnemyTank;
-                    break;
-                case '*':
-                    type = ObjectType::Shell;
-                    shellsPositions.insert({static_cast<int>(x), static_cast<int>(y)});
-                    break;
-                case '#':
-                    type = ObjectType::Wall;
-                    break;
-                case '@':
-                    type = ObjectType::Mine;
-                    break;
-                case '%':
-                    myPosition = {static_cast<int>(x), static_cast<int>(y)};
-                    type = ObjectType::AllyTank;
-                    break;
+        if (bulk) {
+            bulk->copyRow(y, row.data());
+        } else {
+            for (size_t x = 0; x < cols; ++x) {
+                row[x] = view.getObjectAt(x, y);
+            }
+        }
+        classifyViewRow(row.data(), cols, playerIndex, grid[y].data(), masks);
+        if (!query) recordRow(y, cols, masks.shells, masks.self, masks.enemies);
+    }
+    if (query) recordEntities(*query, playerIndex, cols);
+}
+
+template MyBattleInfo::MyBattleInfo(const SatelliteView&, int, size_t, size_t, int);
+template MyBattleInfo::MyBattleInfo(const MySatelliteView&, int, size_t, size_t, int);
+
+/**
+ * @brief Walks the set bits of a row's masks; empty words cost a single test.
+ */
+void MyBattleInfo::recordRow(size_t y, size_t cols, const uint64_t* shells, const uint64_t* self, const uint64_t* enemies) {
+    size_t words = (cols + 63) / 64;
+    for (size_t word = 0; word < words; ++word) {
+        for (uint64_t bits = shells[word]; bits != 0; bits &= bits - 1) {
+            int x = static_cast<int>(word * 64 + std::countr_zero(bits));
+            shellsPositions.insert({x, static_cast<int>(y)});
+        }
+        for (uint64_t bits = self[word]; bits != 0; bits &= bits - 1) {
+            int x = static_cast<int>(word * 64 + std::countr_zero(bits));
+            if (firstSelfPosition.first == -1) firstSelfPosition = {x, static_cast<int>(y)};
+            myPosition = {x, static_cast<int>(y)};
+        }
+        for (uint64_t bits = enemies[word]; bits != 0; bits &= bits - 1) {
+            int x = static_cast<int>(word * 64 + std::countr_zero(bits));
+            enemyTanks.push_back({x, static_cast<int>(y)});
+        }
+    }
+}
+
+/**
+ * @brief Fills the positions from the entity lists; the '%' tanks are ordered row-major so
+ *        that the first and last match the grid scan, and so are the enemies.
+ */
+void MyBattleInfo::recordEntities(const EntityQueryView& query, int playerIndex, size_t cols) {
+    std::vector<std::pair<int, int>> shells;
+    query.listShells(shells);
+    shellsPositions.insert(shells.begin(), shells.end());
+
+    auto rowMajor = [cols](const std::pair<int, int>& position) {
+        return static_cast<size_t>(position.second) * cols + static_cast<size_t>(position.first);
+    };
+    std::vector<TankSighting> sightings;
+    query.listTanks(sightings);
+    for (const TankSighting& tank : sightings) {
+        if (tank.self) {
+            selfCells.push_back(tank.position);
+            if (firstSelfPosition.first == -1 || rowMajor(tank.position) < rowMajor(firstSelfPosition)) {
+                firstSelfPosition = tank.position;
+            }
+            if (myPosition.first == -1 || rowMajor(tank.position) > rowMajor(myPosition)) {
+                myPosition = tank.position;
             }
-            grid[y][x] = type;
+        } else if (tank.owner != playerIndex) {
+            enemyTanks.push_back(tank.position);
         }
     }
-} 
+    std::sort(enemyTanks.begin(), enemyTanks.end(), [&](const auto& a, const auto& b) { return rowMajor(a) < rowMajor(b); });
+}
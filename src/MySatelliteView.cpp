@@ -1,4 +1,5 @@
 #include "MySatelliteView.h"
+#include <cstring>
 
 /**
  * @brief Constructs a MySatelliteView object.
@@ -7,65 +8,86 @@
  * including terrain, tanks, and shells for the requesting tank.
  * 
  * @param board Reference to the full game board.
- * @param posMap Map of current entity positions on the board.
+ * @param raster The turn's shared character raster of the board.
+ * @param occupancy Per-cell index of the entities on the board.
+ * @param tanks The engine's tank table, indexed like the occupancy grid's tank entries.
  * @param requestingTankPos The position of the tank requesting the view.
  */
 MySatelliteView::MySatelliteView(const Board& board,
-                                 const std::map<std::pair<int, int>, std::vector<Entity*>>& posMap,
+                                 const SatelliteRaster& raster,
+                                 const OccupancyGrid& occupancy,
+                                 const TankTable& tanks,
                                  std::pair<int, int> requestingTankPos)
-    : board(board), positionMap(posMap),
+    : board(board), raster(raster), occupancy(occupancy), tanks(tanks),
       rows(board.getRows()), cols(board.getCols()),
       requestingTankPosition(requestingTankPos) {}
 
-
 /**
- * @brief Returns a character representing the object at the given board coordinates.
- * 
- * The character can be:
- * - '#' for a wall
- * - '@' for a mine
- * - '*' for a shell
- * - '1' or '2' for a tank owned by player 1 or 2
- * - '%' for the requesting tank itself
- * - ' ' for empty space
- * - '&' for out-of-bounds access
- * 
- * @param x Column index (0-based) - represents X-axis (cols)
- * @param y Row index (0-based)    - represents Y-axis (rows)
- * @return A char representing the object at the specified coordinates
+ * @brief Copies a row of the shared raster; only its tank characters need a second look,
+ *        since one of them may be the requesting tank. Cells outside the window become '?'.
  */
-char MySatelliteView::getObjectAt(size_t x, size_t y) const {
-    if (y >= (size_t)rows || x >= (size_t)cols){
-        return '&';
+void MySatelliteView::copyRow(size_t y, char* out) const {
+    if (y >= (size_t)rows) {
+        std::memset(out, '&', (size_t)cols);
+        return;
     }
-
-    auto it = positionMap.find({(int)x, (int)y});
-    if (it != positionMap.end()) {
-        for (Entity* e : it->second) {
-            if (e->getType() == "Tank") {
-                if (e->getPosition() == requestingTankPosition){
-                    return '%';
-                }
-
-                Tank* tank = dynamic_cast<Tank*>(e);
-                if (tank) {
-                    int owner = tank->getPlayer();
-                    return owner == 1 ? '1' : '2';
-                }
-            }
-            if (e->getType() == "Shell") {
-                return '*';
-            }
+    if (windowed && !window.withinAxis(y, window.center.second, (size_t)rows)) {
+        std::memset(out, '?', (size_t)cols);
+        return;
+    }
+    std::memcpy(out, raster.rowData(y, (size_t)cols), (size_t)cols);
+    for (size_t x = 0; x < (size_t)cols; ++x) {
+        if (windowed && !window.withinAxis(x, window.center.first, (size_t)cols)) {
+            out[x] = '?';
+        } else if (out[x] == '1' || out[x] == '2') {
+            out[x] = getObjectAt(x, y);
         }
     }
+}
 
-    const Cell& cell = board.getCell((int)x, (int)y);
-    TerrainType terrain = cell.getTerrain();
+/**
+ * @brief Lists the shown tanks from the tank table. Views are handed out before the occupancy grid
+ *        catches up with the turn's moves, so its cells are the ones the raster shows; at most
+ *        one tank stands on a cell then, so the '%' test matches getObjectAt's.
+ */
+void MySatelliteView::listTanks(std::vector<TankSighting>& out) const {
+    out.clear();
+    tanks.forEachAlive([&](size_t i) {
+        auto position = board.toPosition(occupancy.getCell(EntityType::Tank, static_cast<uint32_t>(i)));
+        if (isShown((size_t)position.first, (size_t)position.second)) {
+            out.push_back({position, tanks.getPlayer(i) == 1 ? 1 : 2, tanks.getPosition(i) == requestingTankPosition});
+        }
+        return false;
+    });
+}
 
-    if (terrain == TerrainType::Wall)
-        return '#';
-    if (terrain == TerrainType::Mine)
-        return '@';
+/**
+ * @brief Lists the shown shell cells among the raster's entity cells.
+ */
+void MySatelliteView::listShells(std::vector<std::pair<int, int>>& out) const {
+    out.clear();
+    raster.forEachEntityCell([&](size_t cell, char c) {
+        auto position = board.toPosition(cell);
+        if (c == '*' && isShown((size_t)position.first, (size_t)position.second)) out.push_back(position);
+    });
+}
 
-    return ' ';
+/**
+ * @brief Lists the cells changed since the known version. A cell that showed '%' last time
+ *        showed a tank, so it either changed since (journaled) or still holds a tank.
+ *        A windowed view offers no delta: its window moves with the tank.
+ */
+bool MySatelliteView::listChangedCells(std::vector<std::pair<int, int>>& out) const {
+    out.clear();
+    if (windowed) {
+        return false;
+    }
+    if (!raster.forEachChangeSince(knownVersion, [&](size_t cell) { out.push_back(board.toPosition(cell)); })) {
+        return false;
+    }
+    tanks.forEachAlive([&](size_t i) {
+        out.push_back(board.toPosition(occupancy.getCell(EntityType::Tank, static_cast<uint32_t>(i))));
+        return false;
+    });
+    return true;
 }
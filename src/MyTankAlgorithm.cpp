@@ -1,4 +1,5 @@
 #include "MyTankAlgorithm.h"
+#include "StateHash.h"
 #include <iostream>
 
 /**
@@ -56,10 +57,96 @@ void MyTankAlgorithm::updatePostAction(ActionRequest action) {
  * @param info The BattleInfo object containing updated board data.
  */
 void MyTankAlgorithm::updateGrid(BattleInfo& info){
-    auto myinfo = static_cast<MyBattleInfo&>(info);
-    grid = myinfo.getGrid();
-    rows = static_cast<int>(grid.size());
-    cols = static_cast<int>(grid[0].size());
+    const auto& myinfo = static_cast<const MyBattleInfo&>(info);
+    if (myinfo.isLazy()) {
+        // Nothing is classified here; the snapshot's content hash stands for the grid
+        const auto& snapshot = myinfo.getSnapshot();
+        const ViewWindow& window = myinfo.getWindow();
+        grid.bind(snapshot, myinfo.getSelfCells(), myinfo.getPlayerIndex(), window);
+        rows = static_cast<int>(snapshot->rows);
+        cols = static_cast<int>(snapshot->cols);
+        gridHash = hashCombine(hashCombine(rows, static_cast<uint64_t>(cols)), snapshot->contentHash);
+        gridHash = hashCombine(hashCombine(gridHash, window.center), static_cast<uint64_t>(window.radius));
+        for (const auto& self : myinfo.getSelfCells()) {
+            gridHash = hashCombine(gridHash, self);
+        }
+        return;
+    }
+    if (myinfo.isDelta()) {
+        // Patch the grid kept from the previous info; the hash follows cell by cell
+        const auto& cells = myinfo.getChangedCells();
+        const auto& types = myinfo.getChangedTypes();
+        for (size_t k = 0; k < cells.size(); ++k) {
+            auto [x, y] = cells[k];
+            size_t cell = static_cast<size_t>(y) * cols + x;
+            gridHash ^= cellHash(cell, grid.at(x, y)) ^ cellHash(cell, types[k]);
+            grid.set(x, y, types[k]);
+        }
+        return;
+    }
+    grid.assign(myinfo.getGrid());
+    rows = static_cast<int>(grid.getRows());
+    cols = static_cast<int>(grid.getCols());
+
+    // The grid only changes here, so hash it once instead of on every stateHash() call
+    gridHash = hashCombine(rows, static_cast<uint64_t>(cols));
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < cols; ++x) {
+            gridHash ^= cellHash(static_cast<size_t>(y) * cols + x, grid.at(x, y));
+        }
+    }
+}
+
+/**
+ * @brief Zobrist-style key of a cell holding a type (empty cells contribute nothing).
+ */
+uint64_t MyTankAlgorithm::cellHash(size_t cell, ObjectType type) {
+    if (type == ObjectType::Empty) return 0;
+    return mixHash((static_cast<uint64_t>(cell) << 3) | static_cast<uint64_t>(type));
+}
+
+/**
+ * @brief Hashes every member that drives the next decisions (the grid through its cached hash).
+ */
+uint64_t MyTankAlgorithm::stateHash() const {
+    uint64_t hash = hashCombine(gridHash, myPosition);
+    hash = hashCombine(hash, static_cast<uint64_t>(myDirection));
+    hash = hashCombine(hash, static_cast<uint64_t>(turnsSinceLastUpdate));
+    hash = hashCombine(hash, static_cast<uint64_t>(shootDelay));
+    hash = hashCombine(hash, static_cast<uint64_t>(numShells));
+    for (const auto& shell : shellsPositions) {
+        hash = hashCombine(hash, shell);
+    }
+    return hash;
+}
+
+/**
+ * @brief Appends the scalar members, the known shells and the grid, eight cells per word.
+ */
+void MyTankAlgorithm::appendState(std::vector<uint64_t>& out) const {
+    out.push_back(packPosition(myPosition));
+    out.push_back(static_cast<uint64_t>(myDirection));
+    out.push_back(static_cast<uint32_t>(turnsSinceLastUpdate));
+    out.push_back(static_cast<uint32_t>(shootDelay));
+    out.push_back(static_cast<uint32_t>(numShells));
+    out.push_back(shellsPositions.size());
+    for (const auto& shell : shellsPositions) {
+        out.push_back(packPosition(shell));
+    }
+    size_t gridRows = grid.getRows(), gridCols = grid.getCols();
+    out.push_back(packPosition({static_cast<int>(gridCols), static_cast<int>(gridRows)}));
+    uint64_t word = 0;
+    size_t cell = 0;
+    for (size_t y = 0; y < gridRows; ++y) {
+        for (size_t x = 0; x < gridCols; ++x, ++cell) {
+            word |= static_cast<uint64_t>(grid.at(static_cast<int>(x), static_cast<int>(y))) << ((cell & 7) * 8);
+            if ((cell & 7) == 7) {
+                out.push_back(word);
+                word = 0;
+            }
+        }
+    }
+    if (cell & 7) out.push_back(word);
 }
 
 /**
@@ -166,9 +253,10 @@ ActionRequest MyTankAlgorithm::CheckIfINeedToShootX(int p) {
         newX += dx;
         newY += dy;
         wrapPosition(newX, newY);
-        auto content = grid[newY][newX];
-        // If we hit a wall, line of sight is blocked
-        if (content == ObjectType::Wall || content == ObjectType::AllyTank || (newX == left && newY == right)) {
+        auto content = grid.at(newX, newY);
+        // If we hit a wall or a cell outside the view, line of sight is blocked
+        if (content == ObjectType::Wall || content == ObjectType::AllyTank || content == ObjectType::Unknown ||
+            (newX == left && newY == right)) {
             break;
         }
         if (content == ObjectType::EnemyTank) {
@@ -189,6 +277,42 @@ std::set<std::pair<int, int>> MyTankAlgorithm::getThreatsAroundMe(){
     return shells;
 }
 
+/**
+ * @brief Walks the same cells as getThreatCellsAroundMe and getCurrThreatShells, wrapped
+ *        the same way, and stops at the first one that is the tank's own cell.
+ */
+bool MyTankAlgorithm::isThreatened() const {
+    auto isMe = [this](int x, int y) {
+        wrapPosition(x, y);
+        return x == myPosition.first && y == myPosition.second;
+    };
+    for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+            if (dx == 0 && dy == 0) continue;
+            int nx = myPosition.first + dx;
+            int ny = myPosition.second + dy;
+            wrapPosition(nx, ny);
+            if (!isMe(nx, ny)) continue;
+            auto content = grid.at(nx, ny);
+            if (content == ObjectType::Wall || content == ObjectType::Mine || content == ObjectType::AllyTank || content == ObjectType::EnemyTank ||
+                content == ObjectType::Unknown) {
+                return true;
+            }
+        }
+    }
+    int stepsSecondCell = 2 * (turnsSinceLastUpdate + 1);
+    for (const auto& [x, y] : shellsPositions) {
+        for (int d : {stepsSecondCell - 1, stepsSecondCell}) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    if ((dx != 0 || dy != 0) && isMe(x + dx * d, y + dy * d)) return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
 /**
  * @brief Returns dangerous cells around current position (e.g., mines, walls, tanks).
  * @return Set of dangerous nearby cell positions.
@@ -202,8 +326,9 @@ std::set<std::pair<int, int>> MyTankAlgorithm::getThreatCellsAroundMe() const {
         int nx = pos.first;
         int ny = pos.second;
         wrapPosition(nx, ny);
-        auto content = grid[ny][nx];
-        if (content == ObjectType::Wall || content == ObjectType::Mine || content == ObjectType::AllyTank || content == ObjectType::EnemyTank) {
+        auto content = grid.at(nx, ny);
+        if (content == ObjectType::Wall || content == ObjectType::Mine || content == ObjectType::AllyTank || content == ObjectType::EnemyTank ||
+            content == ObjectType::Unknown) {
             threatPlaces.insert({nx, ny});
         }
     }
@@ -0,0 +1,78 @@
+#include "ObjectGrid.h"
+#include "ViewKernels.h"
+#include <algorithm>
+
+/**
+ * @brief Copies the classified rows into the flat eager form.
+ */
+void ObjectGrid::assign(const std::vector<std::vector<ObjectType>>& grid) {
+    source.reset();
+    rows = grid.size();
+    cols = rows ? grid[0].size() : 0;
+    cells.resize(rows * cols);
+    for (size_t y = 0; y < rows; ++y) {
+        std::copy(grid[y].begin(), grid[y].end(), cells.begin() + static_cast<std::ptrdiff_t>(y * cols));
+    }
+}
+
+/**
+ * @brief Switches to the lazy form; only the slots of the tiles classified so far are cleared.
+ */
+void ObjectGrid::bind(std::shared_ptr<const RasterSnapshot> snapshot, const std::vector<std::pair<int, int>>& self, int player,
+                      const ViewWindow& shown) {
+    size_t tileCount = ((snapshot->rows + TILE_SIZE - 1) >> TILE_SHIFT) * ((snapshot->cols + TILE_SIZE - 1) >> TILE_SHIFT);
+    if (!source || rows != snapshot->rows || cols != snapshot->cols) {
+        tileSlots.assign(tileCount, 0);
+    } else {
+        for (size_t tile : tileIds) tileSlots[tile] = 0;
+    }
+    tiles.clear();
+    tileIds.clear();
+    cells.clear();
+
+    rows = snapshot->rows;
+    cols = snapshot->cols;
+    tilesPerRow = (cols + TILE_SIZE - 1) >> TILE_SHIFT;
+    source = std::move(snapshot);
+    selfCells = self;
+    playerIndex = player;
+    window = shown;
+    windowed = !shown.coversBoard(rows, cols);
+}
+
+/**
+ * @brief Classifies the tile's rows as MyBattleInfo would and marks the tank's own cells.
+ */
+uint32_t ObjectGrid::materialize(size_t tile) const {
+    size_t x0 = (tile % tilesPerRow) << TILE_SHIFT;
+    size_t y0 = (tile / tilesPerRow) << TILE_SHIFT;
+    size_t width = std::min(TILE_SIZE, cols - x0);
+    size_t height = std::min(TILE_SIZE, rows - y0);
+
+    Tile types{};
+    uint64_t maskWords[3];
+    ViewRowMasks masks{&maskWords[0], &maskWords[1], &maskWords[2]};
+    for (size_t r = 0; r < height; ++r) {
+        classifyViewRow(source->row(y0 + r) + x0, width, playerIndex, types.data() + (r << TILE_SHIFT), masks);
+    }
+    for (auto [x, y] : selfCells) {
+        size_t dx = static_cast<size_t>(x) - x0;
+        size_t dy = static_cast<size_t>(y) - y0;
+        if (dx < width && dy < height) types[(dy << TILE_SHIFT) | dx] = ObjectType::AllyTank;
+    }
+
+    tiles.push_back(types);
+    tileIds.push_back(tile);
+    tileSlots[tile] = static_cast<uint32_t>(tiles.size());
+    return tileSlots[tile];
+}
+
+/**
+ * @brief Scans an eager grid; a lazy one is all empty only if it sees the whole board (other
+ *        cells are Unknown) and its snapshot is all blank (the '%' cells show tanks, so they
+ *        are never blank).
+ */
+bool ObjectGrid::allEmpty() const {
+    if (source) return !windowed && source->nonBlankCells == 0;
+    return std::all_of(cells.begin(), cells.end(), [](ObjectType type) { return type == ObjectType::Empty; });
+}
@@ -0,0 +1,110 @@
+#include "OccupancyGrid.h"
+
+/**
+ * @brief Constructs an empty grid whose arrays draw from the given memory resource.
+ */
+OccupancyGrid::OccupancyGrid(std::pmr::memory_resource* resource)
+    : heads(resource),
+      tankNext(resource),
+      shellNext(resource),
+      tankCell(resource),
+      shellCell(resource),
+      changedCells(resource),
+      changedFlags(resource) {}
+
+/**
+ * @brief Clears the grid and resizes it to the given number of cells.
+ */
+void OccupancyGrid::reset(size_t cellCount) {
+    heads.assign(cellCount, NONE);
+    changedFlags.assign(cellCount, 0);
+    changedCells.clear();
+    changedCells.reserve(cellCount);
+    tankNext.clear();
+    shellNext.clear();
+    tankCell.clear();
+    shellCell.clear();
+}
+
+/**
+ * @brief Reserves the per-tank and per-shell arrays so that linking never grows them.
+ */
+void OccupancyGrid::reserve(size_t tankCount, size_t shellCount) {
+    tankNext.reserve(tankCount);
+    tankCell.reserve(tankCount);
+    shellNext.reserve(shellCount);
+    shellCell.reserve(shellCount);
+}
+
+/**
+ * @brief Records that an entity entered the given cell.
+ */
+void OccupancyGrid::markChanged(size_t cell) {
+    if (!changedFlags[cell]) {
+        changedFlags[cell] = 1;
+        changedCells.push_back(cell);
+    }
+}
+
+/**
+ * @brief Links an encoded occupant at the head of a cell, growing the per-occupant arrays on demand.
+ */
+void OccupancyGrid::link(uint32_t ref, size_t cell) {
+    std::pmr::vector<uint32_t>& links = (ref & 1u) ? shellNext : tankNext;
+    if ((ref >> 1) >= links.size()) {
+        links.resize((ref >> 1) + 1, NONE);
+        ((ref & 1u) ? shellCell : tankCell).resize((ref >> 1) + 1, 0);
+    }
+    nextOf(ref) = heads[cell];
+    heads[cell] = ref;
+    cellOf(ref) = cell;
+}
+
+/**
+ * @brief Unlinks an encoded occupant (cells rarely hold more than one entity).
+ */
+void OccupancyGrid::unlink(uint32_t ref) {
+    uint32_t* link = &heads[cellOf(ref)];
+    while (*link != NONE && *link != ref) {
+        link = &nextOf(*link);
+    }
+    if (*link != NONE) {
+        *link = nextOf(ref);
+        nextOf(ref) = NONE;
+    }
+}
+
+/**
+ * @brief Adds an entity to a cell and marks the cell as changed.
+ */
+void OccupancyGrid::insert(EntityType type, uint32_t index, size_t cell) {
+    link(encode(type, index), cell);
+    markChanged(cell);
+}
+
+/**
+ * @brief Removes an entity from the cell it is registered at.
+ */
+void OccupancyGrid::erase(EntityType type, uint32_t index) {
+    unlink(encode(type, index));
+}
+
+/**
+ * @brief Moves an entity from the cell it is registered at to another cell.
+ */
+void OccupancyGrid::move(EntityType type, uint32_t index, size_t to) {
+    uint32_t ref = encode(type, index);
+    unlink(ref);
+    link(ref, to);
+    markChanged(to);
+}
+
+/**
+ * @brief Forgets the recorded changed cells (capacity is kept).
+ */
+void OccupancyGrid::clearChangedCells() {
+    for (size_t cell : changedCells) {
+        changedFlags[cell] = 0;
+    }
+    changedCells.clear();
+}
@@ -0,0 +1,127 @@
+#include "ReachabilityAnalysis.h"
+#include <algorithm>
+#include <deque>
+#include <utility>
+
+/**
+ * @brief Claims the reach set of every live tank in turn and stops at the first tank that
+ *        could be destroyed.
+ */
+ReachabilityAnalysis::ReachabilityAnalysis(const Board& board, const TankTable& tanks) {
+    reachOf.assign(board.getCellCount(), NO_TANK);
+    hitBy.assign(board.getCellCount(), NO_TANK);
+    cost.assign(board.getCellCount(), UNREACHED);
+    walked.assign(board.getCellCount(), 0);
+
+    bool exposed = tanks.forEachAlive([&](size_t i) {
+        auto [x, y] = tanks.getPosition(i);
+        int ammo = tanks.getAmmo(i);
+        collectReach(board, board.toIndex(x, y), static_cast<uint32_t>(ammo / 2));
+        bool armed = ammo > 0;
+        bool found = !claimReach(board, static_cast<uint32_t>(i), armed) || (armed && canMeetOwnShell(board));
+        for (size_t cell : reach) cost[cell] = UNREACHED;
+        return found;
+    });
+    outcomeFixed = !exposed;
+}
+
+/**
+ * @brief Runs the 0-1 BFS; only cells within the budget get a cost, so cost also tells
+ *        whether a cell is in the reach set.
+ */
+void ReachabilityAnalysis::collectReach(const Board& board, size_t start, uint32_t budget) {
+    reach.clear();
+    std::deque<std::pair<size_t, uint32_t>> pending;
+    cost[start] = 0;
+    pending.emplace_back(start, 0);
+    while (!pending.empty()) {
+        auto [cell, walls] = pending.front();
+        pending.pop_front();
+        if (walls != cost[cell]) continue; // reached again more cheaply
+        reach.push_back(cell);
+
+        auto [x, y] = board.toPosition(cell);
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                int nx = x + dx;
+                int ny = y + dy;
+                board.wrapPosition(nx, ny);
+                size_t next = board.toIndex(nx, ny);
+                bool wall = board.getCellAt(next).getTerrain() == TerrainType::Wall;
+                uint32_t nextWalls = walls + (wall ? 1 : 0);
+                if (nextWalls > budget || nextWalls >= cost[next]) continue;
+                cost[next] = nextWalls;
+                if (wall) pending.emplace_back(next, nextWalls);
+                else pending.emplace_front(next, nextWalls);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Checks the 8 neighbours of every cell of the reach set against the reach sets
+ *        claimed so far, and registers the walls bordering an armed tank's reach set.
+ */
+bool ReachabilityAnalysis::claimReach(const Board& board, uint32_t tank, bool armed) {
+    for (size_t cell : reach) {
+        if (board.getCellAt(cell).getTerrain() == TerrainType::Mine) return false;
+        auto [x, y] = board.toPosition(cell);
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                int nx = x + dx;
+                int ny = y + dy;
+                board.wrapPosition(nx, ny);
+                size_t next = board.toIndex(nx, ny);
+                if (reachOf[next] != NO_TANK && reachOf[next] != tank) return false;
+                // A non-wall neighbour would have been reached at the same cost
+                if (armed && cost[next] == UNREACHED) {
+                    if (hitBy[next] != NO_TANK && hitBy[next] != tank) return false;
+                    hitBy[next] = tank;
+                }
+            }
+        }
+        reachOf[cell] = tank;
+    }
+    return true;
+}
+
+/**
+ * @brief Walks every line of the reach set from its first cell, one direction of each
+ *        opposite pair at a time. A cell no walk passed lies on a line that never leaves
+ *        the reach set, around which a shell can fly forever.
+ */
+bool ReachabilityAnalysis::canMeetOwnShell(const Board& board) {
+    const int rows = board.getRows();
+    const int cols = board.getCols();
+    const std::pair<int, int> directions[] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
+    for (auto [dx, dy] : directions) {
+        // Diagonal lines cross both dimensions; the longer one bounds the shortcut
+        size_t span = static_cast<size_t>(dy == 0 ? cols : dx == 0 ? rows : std::max(rows, cols));
+        for (size_t cell : reach) walked[cell] = 0;
+
+        for (size_t cell : reach) {
+            auto [x, y] = board.toPosition(cell);
+            int px = x - dx;
+            int py = y - dy;
+            board.wrapPosition(px, py);
+            if (cost[board.toIndex(px, py)] != UNREACHED) continue;
+
+            size_t flight = 0;
+            walked[cell] = 1;
+            while (true) {
+                x += dx;
+                y += dy;
+                board.wrapPosition(x, y);
+                size_t next = board.toIndex(x, y);
+                if (cost[next] == UNREACHED) break;
+                walked[next] = 1;
+                ++flight;
+            }
+            if (3 * (flight + 1) >= 2 * span) return true;
+        }
+        for (size_t cell : reach) {
+            if (!walked[cell]) return true;
+        }
+    }
+    return false;
+}
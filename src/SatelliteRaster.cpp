@@ -0,0 +1,179 @@
+#include "SatelliteRaster.h"
+#include "StateHash.h"
+
+/**
+ * @brief Constructs an empty raster whose arrays draw from the given memory resource.
+ */
+SatelliteRaster::SatelliteRaster(std::pmr::memory_resource* resource)
+    : chars(resource), dirtyPlane(resource), dirtyWords(resource), shownPlane(resource), shownWords(resource),
+      journalCells(resource), journalVersions(resource), staleRows(resource), staleRowList(resource) {}
+
+/**
+ * @brief Binds the raster and marks every cell dirty.
+ */
+void SatelliteRaster::reset(const Board& gameBoard, const OccupancyGrid& grid, ShellScheduler& scheduler, const TankTable& tankTable) {
+    board = &gameBoard;
+    occupancy = &grid;
+    sleepingShells = &scheduler;
+    tanks = &tankTable;
+
+    size_t cellCount = gameBoard.getCellCount();
+    size_t words = (cellCount + 63) / 64;
+    chars.assign(cellCount, ' ');
+    dirtyPlane.assign(words, ~uint64_t{0});
+    if (cellCount % 64) dirtyPlane.back() = (uint64_t{1} << (cellCount % 64)) - 1;
+    shownPlane.assign(words, 0);
+    // Each word is listed at most once, so these never outgrow the planes
+    dirtyWords.clear();
+    dirtyWords.reserve(words);
+    for (size_t w = 0; w < words; ++w) dirtyWords.push_back(w);
+    shownWords.clear();
+    shownWords.reserve(words);
+    ready = false;
+
+    journalCapacity = cellCount / JOURNAL_SHARE + 64;
+    journalCells.clear();
+    journalCells.reserve(journalCapacity);
+    journalVersions.clear();
+    journalVersions.reserve(journalCapacity);
+    version = 0;
+    journalFloor = 0;
+
+    // No snapshot was taken yet, so every row is stale; the list never outgrows the rows
+    size_t rowCount = static_cast<size_t>(gameBoard.getRows());
+    staleRows.assign(rowCount, 1);
+    staleRowList.clear();
+    staleRowList.reserve(rowCount);
+    for (size_t y = 0; y < rowCount; ++y) staleRowList.push_back(y);
+    contentHash = 0;
+    nonBlankCells = 0;
+    latestSnapshot.reset();
+}
+
+/**
+ * @brief Journals a cell changed by the current refresh. A full journal is emptied, and
+ *        nothing more is journaled until the next refresh (the floor is this version).
+ */
+void SatelliteRaster::journal(size_t cell) {
+    if (journalFloor == version) return;
+    if (journalCells.size() == journalCapacity) {
+        journalCells.clear();
+        journalVersions.clear();
+        journalFloor = version;
+        return;
+    }
+    journalCells.push_back(cell);
+    journalVersions.push_back(version);
+}
+
+/**
+ * @brief Classifies again the cells that may have changed since the last refresh.
+ */
+void SatelliteRaster::refresh() {
+    if (ready) return;
+    ++version;
+    sleepingShells->prepareViews();
+
+    for (size_t cell : occupancy->getChangedCells()) markDirty(cell);
+    sleepingShells->forEachSleepingShellCell([&](size_t cell) { markDirty(cell); });
+    for (size_t w : shownWords) {
+        if (dirtyPlane[w] == 0) dirtyWords.push_back(w);
+        dirtyPlane[w] |= shownPlane[w];
+        shownPlane[w] = 0;
+    }
+    shownWords.clear();
+
+    // Every cell showing an entity now is dirty (entered, shown before, or a sleeping
+    // shell's), so the shown cells can be rebuilt from the dirty ones alone
+    for (size_t w : dirtyWords) {
+        for (uint64_t bits = dirtyPlane[w]; bits; bits &= bits - 1) {
+            size_t cell = (w << 6) | static_cast<size_t>(std::countr_zero(bits));
+            char c = classify(cell);
+            if (c != chars[cell]) {
+                journal(cell);
+                recordChange(cell, chars[cell], c);
+            }
+            chars[cell] = c;
+            if (c == '*' || c == '1' || c == '2') {
+                if (shownPlane[w] == 0) shownWords.push_back(w);
+                shownPlane[w] |= uint64_t{1} << (cell & 63);
+            }
+        }
+        dirtyPlane[w] = 0;
+    }
+    dirtyWords.clear();
+    ready = true;
+}
+
+/**
+ * @brief Keeps the snapshot bookkeeping in step with a changed cell.
+ */
+void SatelliteRaster::recordChange(size_t cell, char before, char after) {
+    contentHash ^= charKey(cell, before) ^ charKey(cell, after);
+    nonBlankCells += (after != ' ');
+    nonBlankCells -= (before != ' ');
+    size_t row = cell / static_cast<size_t>(board->getCols());
+    if (!staleRows[row]) {
+        staleRows[row] = 1;
+        staleRowList.push_back(row);
+    }
+}
+
+/**
+ * @brief Zobrist-style key of a cell showing a character.
+ */
+uint64_t SatelliteRaster::charKey(size_t cell, char c) {
+    if (c == ' ') return 0;
+    return mixHash((static_cast<uint64_t>(cell) << 8) | static_cast<uint8_t>(c));
+}
+
+/**
+ * @brief Builds a snapshot sharing the rows that did not change since the previous one.
+ */
+std::shared_ptr<const RasterSnapshot> SatelliteRaster::snapshot() {
+    if (latestSnapshot && staleRowList.empty()) return latestSnapshot;
+
+    auto next = std::make_shared<RasterSnapshot>();
+    next->rows = static_cast<size_t>(board->getRows());
+    next->cols = static_cast<size_t>(board->getCols());
+    if (latestSnapshot) {
+        next->rowChars = latestSnapshot->rowChars;
+    } else {
+        next->rowChars.resize(next->rows);
+    }
+    for (size_t y : staleRowList) {
+        const char* first = chars.data() + y * next->cols;
+        next->rowChars[y] = std::make_shared<const std::vector<char>>(first, first + next->cols);
+        staleRows[y] = 0;
+    }
+    staleRowList.clear();
+    next->contentHash = contentHash;
+    next->nonBlankCells = nonBlankCells;
+    latestSnapshot = std::move(next);
+    return latestSnapshot;
+}
+
+/**
+ * @brief Returns the tank owner's digit, '*' for a shell, or the terrain character.
+ */
+char SatelliteRaster::classify(size_t cell) const {
+    char tankChar = 0;
+    bool hasShell = false;
+    occupancy->forEachAt(cell, [&](Occupant occupant) {
+        if (occupant.type == EntityType::Tank) {
+            tankChar = tanks->getPlayer(occupant.index) == 1 ? '1' : '2';
+            return true;
+        }
+        hasShell = true;
+        return false;
+    });
+
+    // Tanks take precedence over shells sharing their cell
+    if (tankChar) return tankChar;
+    if (hasShell || sleepingShells->hasSleepingShellAt(cell)) return '*';
+
+    TerrainType terrain = board->getCellAt(cell).getTerrain();
+    if (terrain == TerrainType::Wall) return '#';
+    if (terrain == TerrainType::Mine) return '@';
+    return ' ';
+}
@@ -0,0 +1,166 @@
+#include "ShellKernels.h"
+#include <array>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SHELL_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+static_assert(sizeof(Direction) == sizeof(int), "Kernels load directions as packed 32-bit lanes");
+
+namespace {
+
+/// Per-direction deltas, indexed by the clockwise Direction value (U first).
+constexpr int DELTA_X[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+constexpr int DELTA_Y[8] = {-1, -1, 0, 1, 1, 1, 0, -1};
+
+/**
+ * @brief Portable kernel, also used for the tail of the vector kernels.
+ *
+ * The wrap is branch-free: after one step a coordinate is at most one cell outside
+ * the board, so adding or subtracting the board size under a mask brings it back.
+ */
+void advanceScalar(int* xs, int* ys, const Direction* dirs, size_t begin, size_t count, int cols, int rows) {
+    for (size_t i = begin; i < count; ++i) {
+        int dir = static_cast<int>(dirs[i]);
+        int x = xs[i] + DELTA_X[dir];
+        int y = ys[i] + DELTA_Y[dir];
+        x += cols & -(x < 0);
+        x -= cols & -(x >= cols);
+        y += rows & -(y < 0);
+        y -= rows & -(y >= rows);
+        xs[i] = x;
+        ys[i] = y;
+    }
+}
+
+#ifdef SHELL_KERNELS_X86
+
+/**
+ * @brief SSE2 kernel, four shells per iteration.
+ *
+ * SSE2 has no variable lane shuffle, so the deltas are derived from range compares on
+ * the direction (dx = +1 for UR..DR, -1 for DL..UL; dy = -1 for UL..UR, +1 for DR..DL).
+ */
+void advanceSse2(int* xs, int* ys, const Direction* dirs, size_t count, int cols, int rows) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i vCols = _mm_set1_epi32(cols);
+    const __m128i vRows = _mm_set1_epi32(rows);
+    const __m128i colsMinusOne = _mm_set1_epi32(cols - 1);
+    const __m128i rowsMinusOne = _mm_set1_epi32(rows - 1);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i dir = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dirs + i));
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(xs + i));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ys + i));
+
+        // Compare masks are -1 where true, so subtracting a mask adds one
+        __m128i right = _mm_and_si128(_mm_cmpgt_epi32(dir, zero), _mm_cmplt_epi32(dir, _mm_set1_epi32(4)));
+        __m128i left = _mm_cmpgt_epi32(dir, _mm_set1_epi32(4));
+        __m128i up = _mm_or_si128(_mm_cmplt_epi32(dir, _mm_set1_epi32(2)), _mm_cmpgt_epi32(dir, _mm_set1_epi32(6)));
+        __m128i down = _mm_and_si128(_mm_cmpgt_epi32(dir, _mm_set1_epi32(2)), _mm_cmplt_epi32(dir, _mm_set1_epi32(6)));
+        x = _mm_add_epi32(_mm_sub_epi32(x, right), left);
+        y = _mm_add_epi32(_mm_sub_epi32(y, down), up);
+
+        x = _mm_add_epi32(x, _mm_and_si128(vCols, _mm_cmplt_epi32(x, zero)));
+        x = _mm_sub_epi32(x, _mm_and_si128(vCols, _mm_cmpgt_epi32(x, colsMinusOne)));
+        y = _mm_add_epi32(y, _mm_and_si128(vRows, _mm_cmplt_epi32(y, zero)));
+        y = _mm_sub_epi32(y, _mm_and_si128(vRows, _mm_cmpgt_epi32(y, rowsMinusOne)));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(xs + i), x);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ys + i), y);
+    }
+    advanceScalar(xs, ys, dirs, i, count, cols, rows);
+}
+
+/**
+ * @brief AVX2 kernel, eight shells per iteration; the delta tables fit in one register
+ *        each and are looked up with a cross-lane permute.
+ */
+__attribute__((target("avx2")))
+void advanceAvx2(int* xs, int* ys, const Direction* dirs, size_t count, int cols, int rows) {
+    const __m256i deltaX = _mm256_setr_epi32(0, 1, 1, 1, 0, -1, -1, -1);
+    const __m256i deltaY = _mm256_setr_epi32(-1, -1, 0, 1, 1, 1, 0, -1);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i vCols = _mm256_set1_epi32(cols);
+    const __m256i vRows = _mm256_set1_epi32(rows);
+    const __m256i colsMinusOne = _mm256_set1_epi32(cols - 1);
+    const __m256i rowsMinusOne = _mm256_set1_epi32(rows - 1);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i dir = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dirs + i));
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(xs + i));
+        __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ys + i));
+
+        x = _mm256_add_epi32(x, _mm256_permutevar8x32_epi32(deltaX, dir));
+        y = _mm256_add_epi32(y, _mm256_permutevar8x32_epi32(deltaY, dir));
+
+        x = _mm256_add_epi32(x, _mm256_and_si256(vCols, _mm256_cmpgt_epi32(zero, x)));
+        x = _mm256_sub_epi32(x, _mm256_and_si256(vCols, _mm256_cmpgt_epi32(x, colsMinusOne)));
+        y = _mm256_add_epi32(y, _mm256_and_si256(vRows, _mm256_cmpgt_epi32(zero, y)));
+        y = _mm256_sub_epi32(y, _mm256_and_si256(vRows, _mm256_cmpgt_epi32(y, rowsMinusOne)));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(xs + i), x);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(ys + i), y);
+    }
+    advanceScalar(xs, ys, dirs, i, count, cols, rows);
+}
+
+#endif
+
+/**
+ * @brief Full-range wrapper around the scalar kernel, matching the vector kernels' signature.
+ */
+void advanceScalarAll(int* xs, int* ys, const Direction* dirs, size_t count, int cols, int rows) {
+    advanceScalar(xs, ys, dirs, 0, count, cols, rows);
+}
+
+#ifdef SHELL_KERNELS_X86
+constexpr size_t KERNEL_COUNT = 3;
+#else
+constexpr size_t KERNEL_COUNT = 1;
+#endif
+
+/**
+ * @brief Builds the variant list, checking the running CPU's features once.
+ */
+std::array<ShellKernelVariant, KERNEL_COUNT> listKernels() {
+#ifdef SHELL_KERNELS_X86
+    __builtin_cpu_init();
+    return {{{"avx2", advanceAvx2, __builtin_cpu_supports("avx2") != 0},
+             {"sse2", advanceSse2, __builtin_cpu_supports("sse2") != 0},
+             {"scalar", advanceScalarAll, true}}};
+#else
+    return {{{"scalar", advanceScalarAll, true}}};
+#endif
+}
+
+/**
+ * @brief Picks the widest kernel supported by the running CPU.
+ */
+ShellAdvanceKernel selectKernel() {
+    for (const ShellKernelVariant& variant : getShellKernels()) {
+        if (variant.supported) return variant.advance;
+    }
+    return advanceScalarAll;
+}
+
+} // namespace
+
+/**
+ * @brief Returns the variants, listed on first use.
+ */
+std::span<const ShellKernelVariant> getShellKernels() {
+    static const std::array<ShellKernelVariant, KERNEL_COUNT> kernels = listKernels();
+    return kernels;
+}
+
+/**
+ * @brief Dispatches to the kernel chosen for this CPU on first use.
+ */
+void advanceShellPositions(int* xs, int* ys, const Direction* dirs, size_t count, int cols, int rows) {
+    static const ShellAdvanceKernel kernel = selectKernel();
+    kernel(xs, ys, dirs, count, cols, rows);
+}
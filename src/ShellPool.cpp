@@ -0,0 +1,119 @@
+#include "ShellPool.h"
+#include "ShellKernels.h"
+
+/**
+ * @brief Constructs an empty pool whose arrays draw from the given memory resource.
+ */
+ShellPool::ShellPool(std::pmr::memory_resource* resource)
+    : xs(resource),
+      ys(resource),
+      directions(resource),
+      handles(resource),
+      slots(resource),
+      freeHandles(resource) {}
+
+/**
+ * @brief Exchanges two dense slots and repoints their handles.
+ */
+void ShellPool::swapSlots(size_t a, size_t b) {
+    if (a == b) return;
+    std::swap(xs[a], xs[b]);
+    std::swap(ys[a], ys[b]);
+    std::swap(directions[a], directions[b]);
+    std::swap(handles[a], handles[b]);
+    slots[handles[a]] = static_cast<uint32_t>(a);
+    slots[handles[b]] = static_cast<uint32_t>(b);
+}
+
+/**
+ * @brief Reserves every dense and per-handle array so that spawning never grows them.
+ */
+void ShellPool::reserve(size_t shellCount) {
+    xs.reserve(shellCount);
+    ys.reserve(shellCount);
+    directions.reserve(shellCount);
+    handles.reserve(shellCount);
+    slots.reserve(shellCount);
+    freeHandles.reserve(shellCount);
+}
+
+/**
+ * @brief Appends the shell to the dense arrays, reusing a released handle if one is available,
+ *        and moves it to the end of the awake slots.
+ */
+ShellHandle ShellPool::spawn(int x, int y, Direction dir) {
+    ShellHandle handle;
+    if (!freeHandles.empty()) {
+        handle = freeHandles.back();
+        freeHandles.pop_back();
+    } else {
+        handle = static_cast<ShellHandle>(slots.size());
+        slots.push_back(INVALID_SLOT);
+    }
+
+    slots[handle] = static_cast<uint32_t>(xs.size());
+    xs.push_back(x);
+    ys.push_back(y);
+    directions.push_back(dir);
+    handles.push_back(handle);
+    swapSlots(xs.size() - 1, awakeCount++);
+    return handle;
+}
+
+/**
+ * @brief Moves the last shell into the released slot and recycles the handle.
+ *        An awake shell is first swapped to the end of the awake slots so they stay dense.
+ */
+void ShellPool::release(ShellHandle handle) {
+    if (!isAlive(handle)) return;
+
+    if (slots[handle] < awakeCount) {
+        swapSlots(slots[handle], --awakeCount);
+    }
+
+    uint32_t slot = slots[handle];
+    uint32_t last = static_cast<uint32_t>(xs.size() - 1);
+    if (slot != last) {
+        xs[slot] = xs[last];
+        ys[slot] = ys[last];
+        directions[slot] = directions[last];
+        handles[slot] = handles[last];
+        slots[handles[slot]] = slot;
+    }
+    xs.pop_back();
+    ys.pop_back();
+    directions.pop_back();
+    handles.pop_back();
+
+    slots[handle] = INVALID_SLOT;
+    freeHandles.push_back(handle);
+}
+
+/**
+ * @brief Swaps an awake shell with the last awake one and shrinks the awake range.
+ */
+void ShellPool::sleep(ShellHandle handle) {
+    swapSlots(slots[handle], --awakeCount);
+}
+
+/**
+ * @brief Swaps a sleeping shell with the first sleeping one and grows the awake range.
+ */
+void ShellPool::wake(ShellHandle handle) {
+    swapSlots(slots[handle], awakeCount++);
+}
+
+/**
+ * @brief Runs the vectorized advancement kernel over the awake part of the coordinate arrays.
+ */
+void ShellPool::advanceAwake(int cols, int rows) {
+    advanceShellPositions(xs.data(), ys.data(), directions.data(), awakeCount, cols, rows);
+}
+
+/**
+ * @brief Runs the advancement kernel over one range of awake slots.
+ */
+void ShellPool::advanceAwake(int cols, int rows, size_t firstSlot, size_t lastSlot) {
+    advanceShellPositions(xs.data() + firstSlot, ys.data() + firstSlot, directions.data() + firstSlot,
+                          lastSlot - firstSlot, cols, rows);
+}
@@ -0,0 +1,208 @@
+#include "ShellScheduler.h"
+
+/**
+ * @brief Constructs an empty scheduler whose arrays draw from the given memory resource.
+ */
+ShellScheduler::ShellScheduler(std::pmr::memory_resource* resource)
+    : reservedBy(resource),
+      sleepSteps(resource),
+      wakeSteps(resource),
+      horizons(resource),
+      wheelHeads(resource),
+      wheelNext(resource),
+      wheelPrev(resource),
+      viewPlane(resource),
+      viewWords(resource) {}
+
+/**
+ * @brief Binds the scheduler to the game state and forgets all sleeping shells.
+ */
+void ShellScheduler::reset(const Board& gameBoard, OccupancyGrid& grid, ShellPool& pool) {
+    board = &gameBoard;
+    occupancy = &grid;
+    shells = &pool;
+    step = 0;
+    reservedBy.assign(gameBoard.getCellCount(), NONE);
+    sleepSteps.clear();
+    wakeSteps.clear();
+    horizons.clear();
+    wheelHeads.assign(WHEEL_SIZE, NONE);
+    wheelNext.clear();
+    wheelPrev.clear();
+    viewPlane.assign((gameBoard.getCellCount() + 63) / 64, 0);
+    viewWords.clear();
+    viewWords.reserve(viewPlane.size());
+    viewPlaneReady = false;
+}
+
+/**
+ * @brief Reserves the per-shell arrays so that sleeping never grows them.
+ */
+void ShellScheduler::reserve(size_t shellCount) {
+    sleepSteps.reserve(shellCount);
+    wakeSteps.reserve(shellCount);
+    horizons.reserve(shellCount);
+    wheelNext.reserve(shellCount);
+    wheelPrev.reserve(shellCount);
+}
+
+/**
+ * @brief Counts one shell half-step; the view plane is rebuilt on next use.
+ */
+void ShellScheduler::advanceStep() {
+    ++step;
+    viewPlaneReady = false;
+}
+
+/**
+ * @brief Returns where a sleeping shell is now: its pool position is frozen at the half-step
+ *        it fell asleep, and it has moved one cell per half-step since.
+ */
+std::pair<int, int> ShellScheduler::currentPosition(ShellHandle handle) const {
+    auto [x, y] = shells->getPosition(handle);
+    auto [dx, dy] = getDelta(shells->getDirection(handle));
+    int travelled = static_cast<int>(step - sleepSteps[handle]);
+    int cols = board->getCols();
+    int rows = board->getRows();
+    x = ((x + travelled * dx) % cols + cols) % cols;
+    y = ((y + travelled * dy) % rows + rows) % rows;
+    return {x, y};
+}
+
+/**
+ * @brief Walks the line the shell fell asleep on and clears its reservations.
+ */
+void ShellScheduler::releaseLine(ShellHandle handle, uint32_t length) {
+    auto [x, y] = shells->getPosition(handle);
+    auto [dx, dy] = getDelta(shells->getDirection(handle));
+    reservedBy[board->toIndex(x, y)] = NONE;
+    for (uint32_t i = 0; i < length; ++i) {
+        x += dx;
+        y += dy;
+        board->wrapPosition(x, y);
+        reservedBy[board->toIndex(x, y)] = NONE;
+    }
+}
+
+/**
+ * @brief Unlinks a sleeping shell from the bucket of its wake-up half-step.
+ */
+void ShellScheduler::unlinkWakeUp(ShellHandle handle) {
+    uint32_t next = wheelNext[handle];
+    uint32_t prev = wheelPrev[handle];
+    if (prev == NONE) wheelHeads[wakeSteps[handle] % WHEEL_SIZE] = next;
+    else wheelNext[prev] = next;
+    if (next != NONE) wheelPrev[next] = prev;
+}
+
+/**
+ * @brief Reserves the shell's cell and the clear cells ahead of it; sleeps if there are enough.
+ */
+bool ShellScheduler::trySleep(ShellHandle handle) {
+    auto [x, y] = shells->getPosition(handle);
+    size_t start = board->toIndex(x, y);
+    if (reservedBy[start] != NONE) return false;
+
+    // Anything sharing the shell's cell is an interaction in progress
+    bool shared = occupancy->forEachAt(start, [&](Occupant occupant) {
+        return occupant.type != EntityType::Shell || occupant.index != handle;
+    });
+    if (shared) return false;
+
+    // Reserve the starting cell first so a line that wraps around the board stops at it
+    reservedBy[start] = handle;
+    auto [dx, dy] = getDelta(shells->getDirection(handle));
+    uint32_t horizon = 0;
+    while (horizon < MAX_HORIZON) {
+        x += dx;
+        y += dy;
+        board->wrapPosition(x, y);
+        size_t cell = board->toIndex(x, y);
+        if (reservedBy[cell] != NONE || !occupancy->isFree(cell) ||
+            board->getCellAt(cell).getTerrain() == TerrainType::Wall) {
+            break;
+        }
+        reservedBy[cell] = handle;
+        ++horizon;
+    }
+
+    if (horizon < MIN_HORIZON) {
+        releaseLine(handle, horizon);
+        return false;
+    }
+
+    if (handle >= sleepSteps.size()) {
+        sleepSteps.resize(handle + 1);
+        wakeSteps.resize(handle + 1);
+        horizons.resize(handle + 1);
+        wheelNext.resize(handle + 1);
+        wheelPrev.resize(handle + 1);
+    }
+    sleepSteps[handle] = step;
+    wakeSteps[handle] = step + horizon;
+    horizons[handle] = horizon;
+
+    uint32_t& head = wheelHeads[wakeSteps[handle] % WHEEL_SIZE];
+    wheelPrev[handle] = NONE;
+    wheelNext[handle] = head;
+    if (head != NONE) wheelPrev[head] = handle;
+    head = handle;
+
+    occupancy->erase(EntityType::Shell, handle);
+    shells->sleep(handle);
+    viewPlaneReady = false;
+    return true;
+}
+
+/**
+ * @brief Releases the shell's reservations and puts it back, awake, on its current cell.
+ */
+void ShellScheduler::wake(ShellHandle handle) {
+    auto [x, y] = currentPosition(handle);
+    unlinkWakeUp(handle);
+    releaseLine(handle, horizons[handle]);
+    shells->setPosition(handle, x, y);
+    shells->wake(handle);
+    occupancy->insert(EntityType::Shell, handle, board->toIndex(x, y));
+    viewPlaneReady = false;
+}
+
+/**
+ * @brief Empties the current half-step's bucket. Pending wake-ups are at most MAX_HORIZON
+ *        half-steps ahead and early wake-ups leave their bucket, so every shell in it is due now.
+ */
+void ShellScheduler::wakeDue() {
+    uint32_t& head = wheelHeads[step % WHEEL_SIZE];
+    while (head != NONE) {
+        wake(head);
+    }
+}
+
+/**
+ * @brief Wakes the owners of reserved cells an entity entered. Waking inserts the shell in
+ *        the grid, which appends to the changed cells, so the list is re-read on every iteration.
+ */
+void ShellScheduler::wakeOnChangedCells() {
+    for (size_t i = 0; i < occupancy->getChangedCells().size(); ++i) {
+        uint32_t owner = reservedBy[occupancy->getChangedCells()[i]];
+        if (owner != NONE) {
+            wake(owner);
+        }
+    }
+}
+
+/**
+ * @brief Marks the current cell of every sleeping shell in the view plane.
+ */
+void ShellScheduler::prepareViews() {
+    if (viewPlaneReady) return;
+    for (size_t w : viewWords) viewPlane[w] = 0;
+    viewWords.clear();
+    for (size_t slot = shells->getAwakeCount(); slot < shells->size(); ++slot) {
+        auto [x, y] = currentPosition(shells->getHandleAt(slot));
+        size_t cell = board->toIndex(x, y);
+        if (viewPlane[cell >> 6] == 0) viewWords.push_back(cell >> 6);
+        viewPlane[cell >> 6] |= uint64_t{1} << (cell & 63);
+    }
+    viewPlaneReady = true;
+}
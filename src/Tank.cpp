@@ -1,44 +1,68 @@
 #include "Tank.h"
 
 /**
- * @brief Constructs a new tank with given position, direction, and player ownership.
+ * @brief Gets the current direction of the tank.
  */
-Tank::Tank(Direction dir, int x, int y, int player, int ammo, int id)
-    : Entity(x, y, dir),
-      player(player),
-      ammo(ammo),
-      tankId(id),
-      isAlive(true),
-      shootCooldown(0),
-      backwardDelay(-2)
-      {}
+Direction Tank::getDirection() const {
+    return table->directions[index];
+}
+
+/**
+ * @brief Returns the current position (x, y) of the tank.
+ */
+std::pair<int, int> Tank::getPosition() const {
+    return {table->xs[index], table->ys[index]};
+}
+
+/**
+ * @brief Sets the position of the tank.
+ */
+void Tank::setPosition(int newX, int newY) {
+    table->xs[index] = newX;
+    table->ys[index] = newY;
+}
+
+/**
+ * @brief Computes the next position of the tank in its current direction, with wrapping.
+ */
+std::pair<int, int> Tank::getNextPosition(const Board& board) const {
+    auto [dx, dy] = getDelta(getDirection());
+    int nx = table->xs[index] + dx;
+    int ny = table->ys[index] + dy;
+    board.wrapPosition(nx, ny);
+    return {nx, ny};
+}
+
+/**
+ * @brief Calculates the previous position of the tank in its current direction, with wrapping.
+ */
+std::pair<int, int> Tank::getPrevPosition(const Board& board) const {
+    auto [dx, dy] = getDelta(getDirection());
+    int nx = table->xs[index] - dx;
+    int ny = table->ys[index] - dy;
+    board.wrapPosition(nx, ny);
+    return {nx, ny};
+}
 
 /**
  * @brief Sets the tank's direction.
  */
 void Tank::setDirection(Direction dir) {
-    direction = dir;
+    table->directions[index] = dir;
 }
 
 /**
  * @brief Returns the tank's current ammo count.
  */
 int Tank::getAmmo() const {
-    return ammo;
+    return table->ammoCounts[index];
 }
 
 /**
  * @brief Returns the player ID who owns this tank.
  */
 int Tank::getPlayer() const {
-    return player;
-}
-
-/**
- * @brief Returns the type of entity ("Tank").
- */
-std::string Tank::getType() const {
-    return "Tank";
+    return table->players[index];
 }
 
 /**
@@ -46,8 +70,7 @@ std::string Tank::getType() const {
  */
 void Tank::moveForward(const Board& board) {
     auto [newX, newY] = getNextPosition(board);
-    const Cell& cell = board.getCell(newX, newY);
-    if (cell.getTerrain() != TerrainType::Wall) {
+    if (board.getCellAt(board.toIndex(newX, newY)).getTerrain() != TerrainType::Wall) {
         setPosition(newX, newY);
     }
 }
@@ -57,48 +80,51 @@ void Tank::moveForward(const Board& board) {
  * @param place Number of 1/8 turns to rotate (positive = right, negative = left)
  */
 void Tank::rotate(int place) {
-    int dirValue = (static_cast<int>(direction) + place) % 8;
+    int dirValue = (static_cast<int>(getDirection()) + place) % 8;
     if (dirValue < 0) dirValue += 8;
     setDirection(static_cast<Direction>(dirValue));
 }
 
 /**
  * @brief Shoots a shell from the tank's current position and direction.
- * @return A new Shell object (allocated with new).
+ *        Spending the last shell takes the tank out of the table's armed count.
+ * @return Handle of the shell spawned in the pool.
  */
-Shell* Tank::shoot() {
-    ammo--;
+ShellHandle Tank::shoot(ShellPool& shells) {
+    if (--table->ammoCounts[index] == 0) {
+        --table->armedCount;
+    }
     startShootCooldown();
-    return new Shell(x, y, direction); // Shell gets its own serial number internally
+    return shells.spawn(table->xs[index], table->ys[index], getDirection());
 }
 
 /**
  * @brief Starts a 4-step shooting cooldown.
  */
 void Tank::startShootCooldown() {
-    shootCooldown = 4;
+    table->shootCooldowns[index] = 4;
 }
 
 /**
  * @brief Checks if the tank can currently shoot (has ammo and no cooldown).
  */
 bool Tank::canShoot() const {
-    return shootCooldown == 0 && ammo > 0;
+    return table->shootCooldowns[index] == 0 && table->ammoCounts[index] > 0;
 }
 
 /**
  * @brief Returns the current cooldown value.
  */
 int Tank::getShootCooldown() const {
-    return shootCooldown;
+    return table->shootCooldowns[index];
 }
 
 /**
  * @brief Decreases the cooldown value by 1, if it's greater than 0.
  */
 void Tank::decreaseShootCooldown() {
-    if (shootCooldown > 0) {
-        --shootCooldown;
+    if (table->shootCooldowns[index] > 0) {
+        --table->shootCooldowns[index];
     }
 }
 
@@ -106,43 +132,43 @@ void Tank::decreaseShootCooldown() {
  * @brief Starts a 2-step delay for backward movement.
  */
 void Tank::startBackwardDelay() {
-    backwardDelay = 2;
+    table->backwardDelays[index] = 2;
 }
 
 /**
  * @brief Checks if tank is in normal movement state (not delayed for backward).
  */
 bool Tank::notInBackwardDelay() const {
-    return backwardDelay == -2;
+    return table->backwardDelays[index] == -2;
 }
 
 /**
  * @brief Returns the current backward delay counter.
  */
 int Tank::getBackwardDelay() const {
-    return backwardDelay;
+    return table->backwardDelays[index];
 }
 
 /**
  * @brief Sets the backward delay to a specific value.
  */
 void Tank::setBackwardDelay(int x) {
-    backwardDelay = x;
+    table->backwardDelays[index] = x;
 }
 
 /**
  * @brief Checks if the tank is ready to perform its backward move.
  */
 bool Tank::isReadyToMoveBackward() const {
-    return backwardDelay == 0;
+    return table->backwardDelays[index] == 0;
 }
 
 /**
  * @brief Decreases the backward delay by 1, if active.
  */
 void Tank::decreaseBackwardDelay() {
-    if (backwardDelay > -2) {
-        --backwardDelay;
+    if (table->backwardDelays[index] > -2) {
+        --table->backwardDelays[index];
     }
 }
 
@@ -150,7 +176,7 @@ void Tank::decreaseBackwardDelay() {
  * @brief Resets the backward delay state to normal (-2).
  */
 void Tank::resetBackwardDelay() {
-    backwardDelay = -2;
+    table->backwardDelays[index] = -2;
 }
 
 /**
@@ -158,17 +184,16 @@ void Tank::resetBackwardDelay() {
  */
 void Tank::moveBackward(const Board& board) {
     auto [newX, newY] = getPrevPosition(board);
-    const Cell& cell = board.getCell(newX, newY);
-    if (cell.getTerrain() != TerrainType::Wall) {
+    if (board.getCellAt(board.toIndex(newX, newY)).getTerrain() != TerrainType::Wall) {
         setPosition(newX, newY);
     }
 }
 
 /**
- * @brief Marks the tank as dead (not alive).
+ * @brief Marks the tank as dead (clears its alive bit).
  */
 void Tank::markAsDead() {
-    isAlive = false;
+    table->markAsDead(index);
 }
 
 /**
@@ -176,6 +201,6 @@ void Tank::markAsDead() {
  * @return True if the tank is alive, false otherwise.
  */
 bool Tank::getIsAlive() const {
-    return isAlive;
+    return table->isAlive(index);
 }
 
@@ -0,0 +1,71 @@
+#include "TankTable.h"
+#include "StateHash.h"
+
+/**
+ * @brief Constructs an empty table whose arrays draw from the given memory resource.
+ */
+TankTable::TankTable(std::pmr::memory_resource* resource)
+    : xs(resource),
+      ys(resource),
+      directions(resource),
+      ammoCounts(resource),
+      shootCooldowns(resource),
+      backwardDelays(resource),
+      players(resource),
+      aliveMask(resource),
+      algorithms(resource) {}
+
+/**
+ * @brief Appends a tank to every column and sets its alive bit.
+ */
+size_t TankTable::add(int x, int y, Direction dir, int player, int ammo, std::unique_ptr<TankAlgorithm> algorithm) {
+    size_t index = xs.size();
+    xs.push_back(x);
+    ys.push_back(y);
+    directions.push_back(dir);
+    ammoCounts.push_back(ammo);
+    shootCooldowns.push_back(0);
+    backwardDelays.push_back(-2);
+    players.push_back(static_cast<uint8_t>(player));
+    algorithms.push_back(std::move(algorithm));
+
+    if ((index >> 6) >= aliveMask.size()) {
+        aliveMask.push_back(0);
+    }
+    aliveMask[index >> 6] |= uint64_t{1} << (index & 63);
+    if (ammo > 0) ++armedCount;
+    return index;
+}
+
+/**
+ * @brief XORs the keys of the live tanks (every live tank acts each turn, so they are
+ *        recomputed rather than maintained incrementally).
+ */
+uint64_t TankTable::getStateHash() const {
+    uint64_t hash = 0;
+    forEachAlive([&](size_t i) {
+        uint64_t key = hashCombine(i, std::pair<int, int>{xs[i], ys[i]});
+        key = hashCombine(key, static_cast<uint64_t>(directions[i]));
+        key = hashCombine(key, static_cast<uint64_t>(ammoCounts[i]));
+        key = hashCombine(key, static_cast<uint64_t>(shootCooldowns[i]));
+        key = hashCombine(key, static_cast<uint64_t>(backwardDelays[i]));
+        hash ^= key;
+        return false;
+    });
+    return hash;
+}
+
+/**
+ * @brief Appends the alive mask, then the position, direction, ammo and timers of each live tank.
+ */
+void TankTable::appendState(std::vector<uint64_t>& out) const {
+    out.insert(out.end(), aliveMask.begin(), aliveMask.end());
+    forEachAlive([&](size_t i) {
+        out.push_back(packPosition({xs[i], ys[i]}));
+        out.push_back(static_cast<uint64_t>(directions[i]));
+        out.push_back(static_cast<uint32_t>(ammoCounts[i]));
+        out.push_back(static_cast<uint32_t>(shootCooldowns[i]));
+        out.push_back(static_cast<uint32_t>(backwardDelays[i]));
+        return false;
+    });
+}
@@ -0,0 +1,77 @@
+#include "ThreadPool.h"
+
+/**
+ * @brief Starts threadCount - 1 workers waiting for loops.
+ */
+ThreadPool::ThreadPool(size_t threadCount) {
+    for (size_t i = 1; i < threadCount; ++i) {
+        workers.emplace_back([this] { workerLoop(); });
+    }
+}
+
+/**
+ * @brief Wakes the workers with the stop flag set and joins them.
+ */
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeWorkers.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Publishes the loop, works on it from the calling thread, then waits for the workers.
+ */
+void ThreadPool::run(size_t loopCount, Task loopTask, void* loopContext) {
+    if (workers.empty()) {
+        for (size_t i = 0; i < loopCount; ++i) loopTask(loopContext, i);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = loopTask;
+        context = loopContext;
+        count = loopCount;
+        nextIndex.store(0, std::memory_order_relaxed);
+        busyWorkers = workers.size();
+        ++generation;
+    }
+    wakeWorkers.notify_all();
+    drain();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    loopDone.wait(lock, [this] { return busyWorkers == 0; });
+}
+
+/**
+ * @brief Claims indices with an atomic counter until the loop is exhausted.
+ */
+void ThreadPool::drain() {
+    for (size_t i = nextIndex.fetch_add(1); i < count; i = nextIndex.fetch_add(1)) {
+        task(context, i);
+    }
+}
+
+/**
+ * @brief Waits for each new loop, helps drain it and reports back, until the pool stops.
+ */
+void ThreadPool::workerLoop() {
+    uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeWorkers.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+        drain();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--busyWorkers == 0) loopDone.notify_one();
+        }
+    }
+}
@@ -0,0 +1,192 @@
+#include "ViewKernels.h"
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VIEW_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+static_assert(sizeof(ObjectType) == 1, "Kernels store object types as bytes");
+
+namespace {
+
+/// Hash offset per high nibble: index = (c & 15) ^ HIGH_OFFSET[c >> 4]. The view characters
+/// (' ', '#', '%', '&', '*' in 0x2_, '1', '2', '?' in 0x3_, '@' in 0x4_) all get distinct indices.
+constexpr uint8_t HIGH_OFFSET[16] = {0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+/// Character expected at each index; any other character hashing there is unknown.
+constexpr char EXPECTED[16] = {' ', '1', '2', '#', '@', '%', '&', 0, 0, 0, '*', 0, 0, 0, 0, '?'};
+
+/**
+ * @brief Builds the index -> ObjectType table for a player ('1' and '2' depend on it).
+ */
+void buildTypeTable(int playerIndex, uint8_t table[16]) {
+    std::memset(table, static_cast<int>(ObjectType::Empty), 16);
+    table[1] = static_cast<uint8_t>(playerIndex == 1 ? ObjectType::AllyTank : ObjectType::EnemyTank);
+    table[2] = static_cast<uint8_t>(playerIndex == 2 ? ObjectType::AllyTank : ObjectType::EnemyTank);
+    table[3] = static_cast<uint8_t>(ObjectType::Wall);
+    table[4] = static_cast<uint8_t>(ObjectType::Mine);
+    table[5] = static_cast<uint8_t>(ObjectType::AllyTank);
+    table[10] = static_cast<uint8_t>(ObjectType::Shell);
+    table[15] = static_cast<uint8_t>(ObjectType::Unknown);
+}
+
+/**
+ * @brief Portable kernel, also used for the tail of the vector kernels.
+ */
+void classifyScalar(const char* chars, size_t begin, size_t count, const uint8_t typeTable[16],
+                    ObjectType* types, const ViewRowMasks& masks) {
+    for (size_t i = begin; i < count; ++i) {
+        uint8_t c = static_cast<uint8_t>(chars[i]);
+        uint8_t index = (c & 15) ^ HIGH_OFFSET[c >> 4];
+        ObjectType type = static_cast<uint8_t>(EXPECTED[index]) == c ? static_cast<ObjectType>(typeTable[index])
+                                                                     : ObjectType::Empty;
+        types[i] = type;
+        uint64_t bit = uint64_t{1} << (i & 63);
+        if (type == ObjectType::Shell) masks.shells[i >> 6] |= bit;
+        if (type == ObjectType::EnemyTank) masks.enemies[i >> 6] |= bit;
+        if (c == '%') masks.self[i >> 6] |= bit;
+    }
+}
+
+#ifdef VIEW_KERNELS_X86
+
+/**
+ * @brief SSSE3 kernel, sixteen characters per iteration (pshufb table lookups).
+ */
+__attribute__((target("ssse3")))
+void classifySsse3(const char* chars, size_t count, const uint8_t typeTable[16], ObjectType* types,
+                   const ViewRowMasks& masks) {
+    const __m128i highOffset = _mm_loadu_si128(reinterpret_cast<const __m128i*>(HIGH_OFFSET));
+    const __m128i expected = _mm_loadu_si128(reinterpret_cast<const __m128i*>(EXPECTED));
+    const __m128i typeLookup = _mm_loadu_si128(reinterpret_cast<const __m128i*>(typeTable));
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i shellType = _mm_set1_epi8(static_cast<char>(ObjectType::Shell));
+    const __m128i enemyType = _mm_set1_epi8(static_cast<char>(ObjectType::EnemyTank));
+    const __m128i selfChar = _mm_set1_epi8('%');
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+        __m128i high = _mm_and_si128(_mm_srli_epi16(c, 4), nibble);
+        __m128i index = _mm_xor_si128(_mm_and_si128(c, nibble), _mm_shuffle_epi8(highOffset, high));
+        __m128i known = _mm_cmpeq_epi8(_mm_shuffle_epi8(expected, index), c);
+        __m128i type = _mm_and_si128(_mm_shuffle_epi8(typeLookup, index), known);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(types + i), type);
+
+        unsigned shift = i & 63;
+        masks.shells[i >> 6] |= uint64_t(unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(type, shellType)))) << shift;
+        masks.enemies[i >> 6] |= uint64_t(unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(type, enemyType)))) << shift;
+        masks.self[i >> 6] |= uint64_t(unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(c, selfChar)))) << shift;
+    }
+    classifyScalar(chars, i, count, typeTable, types, masks);
+}
+
+/**
+ * @brief AVX2 kernel, thirty-two characters per iteration (the tables are repeated in
+ *        both 128-bit lanes, since vpshufb looks up within each lane).
+ */
+__attribute__((target("avx2")))
+void classifyAvx2(const char* chars, size_t count, const uint8_t typeTable[16], ObjectType* types,
+                  const ViewRowMasks& masks) {
+    const __m256i highOffset = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(HIGH_OFFSET)));
+    const __m256i expected = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(EXPECTED)));
+    const __m256i typeLookup = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(typeTable)));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i shellType = _mm256_set1_epi8(static_cast<char>(ObjectType::Shell));
+    const __m256i enemyType = _mm256_set1_epi8(static_cast<char>(ObjectType::EnemyTank));
+    const __m256i selfChar = _mm256_set1_epi8('%');
+
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chars + i));
+        __m256i high = _mm256_and_si256(_mm256_srli_epi16(c, 4), nibble);
+        __m256i index = _mm256_xor_si256(_mm256_and_si256(c, nibble), _mm256_shuffle_epi8(highOffset, high));
+        __m256i known = _mm256_cmpeq_epi8(_mm256_shuffle_epi8(expected, index), c);
+        __m256i type = _mm256_and_si256(_mm256_shuffle_epi8(typeLookup, index), known);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(types + i), type);
+
+        unsigned shift = i & 63;
+        masks.shells[i >> 6] |= uint64_t(unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(type, shellType)))) << shift;
+        masks.enemies[i >> 6] |= uint64_t(unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(type, enemyType)))) << shift;
+        masks.self[i >> 6] |= uint64_t(unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(c, selfChar)))) << shift;
+    }
+    classifyScalar(chars, i, count, typeTable, types, masks);
+}
+
+#endif
+
+using ClassifyKernel = void (*)(const char*, size_t, const uint8_t[16], ObjectType*, const ViewRowMasks&);
+
+/**
+ * @brief Full-range wrapper around the scalar kernel, matching the vector kernels' signature.
+ */
+void classifyScalarAll(const char* chars, size_t count, const uint8_t typeTable[16], ObjectType* types,
+                       const ViewRowMasks& masks) {
+    classifyScalar(chars, 0, count, typeTable, types, masks);
+}
+
+/**
+ * @brief Gives a kernel the classifyViewRow contract: clears the masks and builds the
+ *        player's type table first.
+ */
+template <ClassifyKernel kernel>
+void classifyRow(const char* chars, size_t count, int playerIndex, ObjectType* types, const ViewRowMasks& masks) {
+    size_t words = (count + 63) / 64;
+    std::memset(masks.shells, 0, words * sizeof(uint64_t));
+    std::memset(masks.self, 0, words * sizeof(uint64_t));
+    std::memset(masks.enemies, 0, words * sizeof(uint64_t));
+
+    uint8_t typeTable[16];
+    buildTypeTable(playerIndex, typeTable);
+    kernel(chars, count, typeTable, types, masks);
+}
+
+#ifdef VIEW_KERNELS_X86
+constexpr size_t KERNEL_COUNT = 3;
+#else
+constexpr size_t KERNEL_COUNT = 1;
+#endif
+
+/**
+ * @brief Builds the variant list, checking the running CPU's features once.
+ */
+std::array<ViewKernelVariant, KERNEL_COUNT> listKernels() {
+#ifdef VIEW_KERNELS_X86
+    __builtin_cpu_init();
+    return {{{"avx2", classifyRow<classifyAvx2>, __builtin_cpu_supports("avx2") != 0},
+             {"ssse3", classifyRow<classifySsse3>, __builtin_cpu_supports("ssse3") != 0},
+             {"scalar", classifyRow<classifyScalarAll>, true}}};
+#else
+    return {{{"scalar", classifyRow<classifyScalarAll>, true}}};
+#endif
+}
+
+/**
+ * @brief Picks the widest kernel supported by the running CPU.
+ */
+ViewClassifyKernel selectKernel() {
+    for (const ViewKernelVariant& variant : getViewKernels()) {
+        if (variant.supported) return variant.classify;
+    }
+    return classifyRow<classifyScalarAll>;
+}
+
+} // namespace
+
+/**
+ * @brief Returns the variants, listed on first use.
+ */
+std::span<const ViewKernelVariant> getViewKernels() {
+    static const std::array<ViewKernelVariant, KERNEL_COUNT> kernels = listKernels();
+    return kernels;
+}
+
+/**
+ * @brief Dispatches to the kernel chosen for this CPU on first use.
+ */
+void classifyViewRow(const char* chars, size_t count, int playerIndex, ObjectType* types, const ViewRowMasks& masks) {
+    static const ViewClassifyKernel kernel = selectKernel();
+    kernel(chars, count, playerIndex, types, masks);
+}
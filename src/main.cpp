@@ -1,17 +1,50 @@
 #include "GameManager.h"
+#include "GameOptions.h"
 #include "MyPlayerFactory.h"
 #include "MyTankAlgorithmFactory.h"
+#include <string>
+#include <cstdlib>
+
+/**
+ * @brief Parses the N of a "--name=N" flag; returns false if it is not a plain number.
+ */
+static bool parseCount(const char* value, size_t& count) {
+    char* end = nullptr;
+    count = std::strtoul(value, &end, 10);
+    return end != value && *end == '\0';
+}
 
 int main(int argc, char* argv[]) {
-    if (argc != 2) return 1;
+    // Usage: tanks_game [--short-circuit] [--threads=N] [--stripes=N] [--delta-info] [--lazy-info] [--view-radius=N] <board file>
+    GameOptions options;
+    const char* boardFile = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--short-circuit") options.shortCircuitFixedOutcomes = true;
+        else if (arg == "--delta-info") options.deltaBattleInfo = true;
+        else if (arg == "--lazy-info") options.lazyBattleInfo = true;
+        else if (arg.rfind("--view-radius=", 0) == 0) {
+            if (!parseCount(argv[i] + 14, options.viewRadius)) return 1;
+        }
+        else if (arg.rfind("--threads=", 0) == 0) {
+            if (!parseCount(argv[i] + 10, options.decisionThreads)) return 1;
+        }
+        else if (arg.rfind("--stripes=", 0) == 0) {
+            if (!parseCount(argv[i] + 10, options.shellStripes)) return 1;
+        }
+        else if (boardFile == nullptr && arg.rfind("--", 0) != 0) boardFile = argv[i];
+        else return 1;
+    }
+    if (boardFile == nullptr) return 1;
 
     GameManager game(
         std::make_unique<MyPlayerFactory>(), 
-        std::make_unique<MyTankAlgorithmFactory>()
+        std::make_unique<MyTankAlgorithmFactory>(),
+        options
     );
 
-    if (!game.readBoard(argv[1])) return 1;
+    if (!game.readBoard(boardFile)) return 1;
     
     game.run();
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,16 @@
+#include "Test.h"
+
+/**
+ * @brief Playing back the chasing tanks' plans, taken in part straight from their cached
+ *        paths, must give the output of asking them for one action per turn, also on an
+ *        open board with long paths and on a crowded one where plans are cut short.
+ */
+void testActionPlans() {
+    GameOptions planned;
+    GameOptions threaded;
+    threaded.decisionThreads = 2;
+    expectSameOutputs({planned, threaded}, HidePlans, {
+        writeRandomBoard("plans_open.txt", 10, 30, 2, 3),
+        writeRandomBoard("plans_crowded.txt", 16, 16, 6, 5),
+    });
+}
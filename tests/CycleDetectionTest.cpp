@@ -0,0 +1,26 @@
+#include "Test.h"
+#include <algorithm>
+#include <string>
+
+/**
+ * @brief Two tanks walled into their own rooms settle into a repeating pattern long before
+ *        maxSteps. Fast-forwarding it must write the lines the full simulation writes.
+ */
+void testCycleDetection() {
+    std::string board = writeBoard("cycle_rooms.txt", 500, 3, {
+        "############",
+        "#1  ##   2 #",
+        "#   ##     #",
+        "#   ##     #",
+        "############",
+    });
+    std::string fastForwarded = playGame(board);
+    std::string simulated = playGame(board, {}, HideStateHash);
+    CHECK(fastForwarded == simulated, "cycling board: output with fast-forward differs from the full simulation");
+    CHECK(std::count(simulated.begin(), simulated.end(), '\n') == 501, "cycling board: expected every turn plus the result line");
+
+    for (const char* input : {"inputs/input_a.txt", "inputs/input_b.txt", "inputs/input_c.txt"}) {
+        std::string file = repoFile(input);
+        CHECK(playGame(file) == playGame(file, {}, HideStateHash), input << ": output with fast-forward differs");
+    }
+}
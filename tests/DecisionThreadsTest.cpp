@@ -0,0 +1,17 @@
+#include "Test.h"
+
+/**
+ * @brief Collecting the tanks' actions on worker threads must not change the output, with
+ *        the shell stripes split over the same threads or not.
+ */
+void testDecisionThreads() {
+    std::vector<GameOptions> variants;
+    for (size_t threads : {2, 4}) {
+        GameOptions options;
+        options.decisionThreads = threads;
+        variants.push_back(options);
+        options.shellStripes = threads;
+        variants.push_back(options);
+    }
+    expectSameOutputs(variants);
+}
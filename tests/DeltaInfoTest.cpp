@@ -0,0 +1,13 @@
+#include "Test.h"
+
+/**
+ * @brief Battle infos listing only the changed cells must leave the tanks with the same grids,
+ *        so the output must not change, with the tanks' actions collected serially or on threads.
+ */
+void testDeltaInfo() {
+    GameOptions delta;
+    delta.deltaBattleInfo = true;
+    GameOptions threaded = delta;
+    threaded.decisionThreads = 4;
+    expectSameOutputs({delta, threaded});
+}
@@ -0,0 +1,101 @@
+#include "Test.h"
+#include "GameManager.h"
+#include "EntityQueryView.h"
+#include "MyPlayerFactory.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Checks the entity lists of every view against a getObjectAt scan, then hands the
+ *        view on to the built-in player so that the game goes on as usual.
+ */
+class EntityCheckingPlayer : public Player {
+    std::unique_ptr<Player> player;
+    size_t rows;
+    size_t cols;
+    size_t& requests;
+
+public:
+    EntityCheckingPlayer(int playerIndex, size_t x, size_t y, size_t maxSteps, size_t numShells, size_t& requests)
+        : Player(playerIndex, x, y, maxSteps, numShells),
+          player(MyPlayerFactory().create(playerIndex, x, y, maxSteps, numShells)), rows(y), cols(x),
+          requests(requests) {}
+
+    void updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& view) override {
+        auto* entities = dynamic_cast<EntityQueryView*>(&view);
+        CHECK(entities, "the engine's views can list their entities");
+        if (entities) {
+            std::vector<std::pair<int, int>> scannedShells;
+            std::vector<std::pair<std::pair<int, int>, char>> scannedTanks;
+            for (size_t y = 0; y < rows; ++y) {
+                for (size_t x = 0; x < cols; ++x) {
+                    std::pair<int, int> cell = {static_cast<int>(x), static_cast<int>(y)};
+                    char c = view.getObjectAt(x, y);
+                    if (c == '*') scannedShells.push_back(cell);
+                    if (c == '1' || c == '2' || c == '%') scannedTanks.push_back({cell, c});
+                }
+            }
+
+            std::vector<std::pair<int, int>> listedShells;
+            entities->listShells(listedShells);
+            std::sort(listedShells.begin(), listedShells.end());
+            std::sort(scannedShells.begin(), scannedShells.end());
+            CHECK(listedShells == scannedShells, "listShells gives the cells showing '*'");
+
+            std::vector<TankSighting> sightings;
+            entities->listTanks(sightings);
+            std::vector<std::pair<std::pair<int, int>, char>> listedTanks;
+            for (const TankSighting& tank : sightings) {
+                listedTanks.push_back({tank.position, tank.self ? '%' : static_cast<char>('0' + tank.owner)});
+            }
+            std::sort(listedTanks.begin(), listedTanks.end());
+            std::sort(scannedTanks.begin(), scannedTanks.end());
+            CHECK(listedTanks == scannedTanks, "listTanks gives the cells showing a tank, with their digit or '%'");
+        }
+        ++requests;
+
+        player->updateTankWithBattleInfo(tank, view);
+    }
+};
+
+/**
+ * @brief Creates EntityCheckingPlayers.
+ */
+class EntityCheckingPlayerFactory : public PlayerFactory {
+    size_t& requests;
+
+public:
+    explicit EntityCheckingPlayerFactory(size_t& requests) : requests(requests) {}
+
+    std::unique_ptr<Player> create(int playerIndex, size_t x, size_t y, size_t maxSteps, size_t numShells) const override {
+        return std::make_unique<EntityCheckingPlayer>(playerIndex, x, y, maxSteps, numShells, requests);
+    }
+};
+
+} // namespace
+
+/**
+ * @brief Plays games with players that compare every view's listTanks and listShells with
+ *        what getObjectAt shows, on random boards (shells in flight, sleeping or not) and
+ *        the sample inputs.
+ */
+void testEntityLists() {
+    std::string boards[] = {
+        writeRandomBoard("entities_small.txt", 12, 16, 3, 7),
+        writeRandomBoard("entities_large.txt", 40, 60, 12, 11),
+        repoFile("inputs/input_a.txt"),
+        repoFile("inputs/input_b.txt"),
+        repoFile("inputs/input_c.txt"),
+    };
+    for (const std::string& board : boards) {
+        size_t requests = 0;
+        GameManager game(std::make_unique<EntityCheckingPlayerFactory>(requests), makeAlgorithmFactory());
+        if (game.readBoard(board)) game.run();
+        CHECK(requests > 0, board << ": the tanks asked for battle info");
+    }
+}
@@ -0,0 +1,165 @@
+#include "Test.h"
+#include "GameManager.h"
+#include "MyPlayerFactory.h"
+#include "MyTankAlgorithmFactory.h"
+#include "ActionPlanner.h"
+#include "StateHashable.h"
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+namespace {
+
+/**
+ * @brief Forwards the TankAlgorithm calls to a built-in algorithm and nothing else, so the
+ *        game manager sees none of its optional interfaces.
+ */
+class PlainAlgorithm : public TankAlgorithm {
+protected:
+    std::unique_ptr<TankAlgorithm> inner; ///< The wrapped algorithm
+
+public:
+    explicit PlainAlgorithm(std::unique_ptr<TankAlgorithm> algorithm) : inner(std::move(algorithm)) {}
+    ActionRequest getAction() override { return inner->getAction(); }
+    void updateBattleInfo(BattleInfo& info) override { inner->updateBattleInfo(info); }
+};
+
+/**
+ * @brief Also forwards StateHashable (the wrapped algorithm must implement it).
+ */
+class HashableAlgorithm final : public PlainAlgorithm, public StateHashable {
+public:
+    using PlainAlgorithm::PlainAlgorithm;
+    uint64_t stateHash() const override { return dynamic_cast<const StateHashable&>(*inner).stateHash(); }
+    void appendState(std::vector<uint64_t>& out) const override { dynamic_cast<const StateHashable&>(*inner).appendState(out); }
+};
+
+/**
+ * @brief Also forwards ActionPlanner (the wrapped algorithm must implement it).
+ */
+class PlanningAlgorithm final : public PlainAlgorithm, public ActionPlanner {
+public:
+    using PlainAlgorithm::PlainAlgorithm;
+    size_t planActions(ActionRequest* out, size_t maxActions) override {
+        return dynamic_cast<ActionPlanner&>(*inner).planActions(out, maxActions);
+    }
+};
+
+/**
+ * @brief Wraps each built-in algorithm in the wrapper that forwards what is not hidden.
+ */
+class HidingFactory final : public TankAlgorithmFactory {
+    MyTankAlgorithmFactory builtin;
+    unsigned hidden;
+
+public:
+    explicit HidingFactory(unsigned hidden) : hidden(hidden) {}
+
+    std::unique_ptr<TankAlgorithm> create(int player_index, int tank_index) const override {
+        std::unique_ptr<TankAlgorithm> algorithm = builtin.create(player_index, tank_index);
+        bool hashable = !(hidden & HideStateHash) && dynamic_cast<StateHashable*>(algorithm.get());
+        bool planning = !(hidden & HidePlans) && dynamic_cast<ActionPlanner*>(algorithm.get());
+        // No wrapper forwards both; hiding one of them is all a test needs
+        if (hashable) return std::make_unique<HashableAlgorithm>(std::move(algorithm));
+        if (planning) return std::make_unique<PlanningAlgorithm>(std::move(algorithm));
+        return std::make_unique<PlainAlgorithm>(std::move(algorithm));
+    }
+};
+
+/**
+ * @brief Spells options out as the command-line flags that set them, for failure messages.
+ */
+std::string describeOptions(const GameOptions& options) {
+    std::ostringstream flags;
+    if (options.shortCircuitFixedOutcomes) flags << " --short-circuit";
+    if (options.decisionThreads) flags << " --threads=" << options.decisionThreads;
+    if (options.shellStripes) flags << " --stripes=" << options.shellStripes;
+    if (options.deltaBattleInfo) flags << " --delta-info";
+    if (options.lazyBattleInfo) flags << " --lazy-info";
+    if (options.viewRadius) flags << " --view-radius=" << options.viewRadius;
+    return flags.str().empty() ? " no flags" : flags.str();
+}
+
+} // namespace
+
+/**
+ * @brief Returns the built-in factory, or a wrapping one when something is hidden.
+ */
+std::unique_ptr<TankAlgorithmFactory> makeAlgorithmFactory(unsigned hidden) {
+    if (hidden == HideNothing) return std::make_unique<MyTankAlgorithmFactory>();
+    return std::make_unique<HidingFactory>(hidden);
+}
+
+/**
+ * @brief Writes the header lines, then the map rows as given.
+ */
+std::string writeBoard(const std::string& name, int maxSteps, int numShells, const std::vector<std::string>& map) {
+    std::ofstream file(name);
+    file << "Test board\n"
+         << "MaxSteps = " << maxSteps << "\n"
+         << "NumShells = " << numShells << "\n"
+         << "Rows = " << map.size() << "\n"
+         << "Cols = " << (map.empty() ? 0 : map[0].size()) << "\n";
+    for (const std::string& row : map) file << row << "\n";
+    return name;
+}
+
+/**
+ * @brief Scatters walls (10%), mines (1%) and each player's tanks over empty cells.
+ */
+std::string writeRandomBoard(const std::string& name, size_t rows, size_t cols, size_t tanksPerPlayer, unsigned seed) {
+    std::mt19937 random(seed);
+    std::vector<std::string> map(rows, std::string(cols, ' '));
+    for (std::string& row : map) {
+        for (char& c : row) {
+            int roll = static_cast<int>(random() % 100);
+            if (roll < 10) c = '#';
+            else if (roll < 11) c = '@';
+        }
+    }
+    for (char player : {'1', '2'}) {
+        for (size_t placed = 0; placed < tanksPerPlayer;) {
+            char& c = map[random() % rows][random() % cols];
+            if (c != ' ') continue;
+            c = player;
+            ++placed;
+        }
+    }
+    return writeBoard(name, 300, 8, map);
+}
+
+/**
+ * @brief Plays the game, then reads back the output file it wrote in the working directory.
+ */
+std::string playGame(const std::string& boardFile, const GameOptions& options, unsigned hidden) {
+    {
+        GameManager game(std::make_unique<MyPlayerFactory>(), makeAlgorithmFactory(hidden), options);
+        if (game.readBoard(boardFile)) game.run();
+    }
+    std::ifstream output("output_" + std::filesystem::path(boardFile).filename().string());
+    std::stringstream content;
+    content << output.rdbuf();
+    return content.str();
+}
+
+/**
+ * @brief Compares each variant's output with the reference output, board by board.
+ */
+void expectSameOutputs(const std::vector<GameOptions>& variants, unsigned referenceHidden,
+                       const std::vector<std::string>& moreBoards) {
+    std::vector<std::string> boards = {
+        writeRandomBoard("same_small.txt", 12, 16, 3, 7),
+        writeRandomBoard("same_large.txt", 40, 60, 12, 11),
+        repoFile("inputs/input_a.txt"),
+        repoFile("inputs/input_b.txt"),
+        repoFile("inputs/input_c.txt"),
+    };
+    boards.insert(boards.end(), moreBoards.begin(), moreBoards.end());
+    for (const std::string& board : boards) {
+        std::string reference = playGame(board, {}, referenceHidden);
+        for (const GameOptions& options : variants) {
+            CHECK(playGame(board, options) == reference, board << ": output with" << describeOptions(options) << " differs");
+        }
+    }
+}
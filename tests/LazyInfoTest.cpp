@@ -0,0 +1,16 @@
+#include "Test.h"
+
+/**
+ * @brief Tanks classifying only the cells they read from a shared snapshot must read the same
+ *        types, so the output must not change, also on threads and with --delta-info (which
+ *        --lazy-info takes precedence over).
+ */
+void testLazyInfo() {
+    GameOptions lazy;
+    lazy.lazyBattleInfo = true;
+    GameOptions threaded = lazy;
+    threaded.decisionThreads = 4;
+    GameOptions withDelta = threaded;
+    withDelta.deltaBattleInfo = true;
+    expectSameOutputs({lazy, threaded, withDelta});
+}
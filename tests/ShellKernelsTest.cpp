@@ -0,0 +1,88 @@
+#include "Test.h"
+#include "ShellKernels.h"
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Random shells on a board, one in three on an edge so that every wrap case shows up.
+ */
+struct ShellBatch {
+    std::vector<int> xs;
+    std::vector<int> ys;
+    std::vector<Direction> dirs;
+
+    ShellBatch(size_t count, int cols, int rows, std::mt19937& random) {
+        auto coordinate = [&](int size) {
+            switch (random() % 6) {
+                case 0: return 0;
+                case 1: return size - 1;
+                default: return static_cast<int>(random() % size);
+            }
+        };
+        for (size_t i = 0; i < count; ++i) {
+            xs.push_back(coordinate(cols));
+            ys.push_back(coordinate(rows));
+            dirs.push_back(static_cast<Direction>(random() % 8));
+        }
+    }
+};
+
+/**
+ * @brief One step as the engine took it before the kernels: getDelta, then a modulo wrap.
+ */
+void referenceStep(ShellBatch& batch, int cols, int rows) {
+    for (size_t i = 0; i < batch.xs.size(); ++i) {
+        auto [dx, dy] = getDelta(batch.dirs[i]);
+        batch.xs[i] = (batch.xs[i] + dx + cols) % cols;
+        batch.ys[i] = (batch.ys[i] + dy + rows) % rows;
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Runs every kernel the CPU supports on the same random batches, over board shapes
+ *        down to one cell and counts that leave every possible vector tail, and compares
+ *        each result with the reference step. Kernels the CPU lacks are reported as skipped.
+ */
+void testShellKernels() {
+    const int shapes[][2] = {{1, 1}, {1, 7}, {7, 1}, {2, 3}, {5, 17}, {64, 64}, {1000, 3}};
+    std::mt19937 random(2024);
+
+    for (const ShellKernelVariant& kernel : getShellKernels()) {
+        if (!kernel.supported) {
+            std::cout << "  skipped kernel " << kernel.name << " (not supported by this CPU)\n";
+            continue;
+        }
+        for (const auto& shape : shapes) {
+            int cols = shape[0];
+            int rows = shape[1];
+            for (size_t count = 0; count <= 40; ++count) {
+                ShellBatch batch(count, cols, rows, random);
+                ShellBatch expected = batch;
+                // A few steps in a row, so results feed back in as inputs
+                for (int step = 0; step < 3; ++step) {
+                    kernel.advance(batch.xs.data(), batch.ys.data(), batch.dirs.data(), count, cols, rows);
+                    referenceStep(expected, cols, rows);
+                }
+                CHECK(batch.xs == expected.xs && batch.ys == expected.ys,
+                      kernel.name << " kernel, " << cols << "x" << rows << " board, " << count << " shells");
+            }
+        }
+        ShellBatch large(100003, 4096, 4096, random);
+        ShellBatch expected = large;
+        kernel.advance(large.xs.data(), large.ys.data(), large.dirs.data(), large.xs.size(), 4096, 4096);
+        referenceStep(expected, 4096, 4096);
+        CHECK(large.xs == expected.xs && large.ys == expected.ys, kernel.name << " kernel, 100003 shells");
+    }
+
+    // The dispatcher must run one of the variants checked above
+    ShellBatch batch(1000, 33, 9, random);
+    ShellBatch expected = batch;
+    advanceShellPositions(batch.xs.data(), batch.ys.data(), batch.dirs.data(), batch.xs.size(), 33, 9);
+    referenceStep(expected, 33, 9);
+    CHECK(batch.xs == expected.xs && batch.ys == expected.ys, "advanceShellPositions");
+}
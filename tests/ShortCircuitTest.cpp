@@ -0,0 +1,64 @@
+#include "Test.h"
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Returns the last line of an output file (the result line), with its newline.
+ */
+std::string lastLine(const std::string& output) {
+    return output.substr(output.rfind('\n', output.size() - 2) + 1);
+}
+
+/**
+ * @brief Two rooms 6 walls apart, also 6 walls thick towards the wrapped edges, which
+ *        4 shells per tank cannot break through.
+ */
+std::vector<std::string> sealedRooms() {
+    std::vector<std::string> map(6, std::string(24, '#'));
+    for (int row = 0; row < 3; ++row) map.push_back("###    ######     ######");
+    for (int row = 0; row < 6; ++row) map.push_back(std::string(24, '#'));
+    map[7][4] = '1';
+    map[7][15] = '2';
+    return map;
+}
+
+} // namespace
+
+/**
+ * @brief A board whose outcome is fixed writes only the result line the full game ends
+ *        with; any other board is played in full.
+ */
+void testShortCircuit() {
+    GameOptions shortCircuit;
+    shortCircuit.shortCircuitFixedOutcomes = true;
+
+    // Armed tanks that cannot reach anything, too few steps for the zero-shells tie
+    std::string armed = writeBoard("short_armed.txt", 50, 4, sealedRooms());
+    std::string full = playGame(armed);
+    CHECK(playGame(armed, shortCircuit) == lastLine(full), "sealed armed board: expected only the result line of the full game");
+
+    // Unarmed tanks: the zero-shells tie
+    std::string unarmed = writeBoard("short_unarmed.txt", 100, 0, sealedRooms());
+    full = playGame(unarmed);
+    CHECK(playGame(unarmed, shortCircuit) == lastLine(full), "sealed unarmed board: expected only the result line of the full game");
+
+    // Time for every shell to be fired: the tie step depends on the algorithms
+    std::string longGame = writeBoard("short_long.txt", 200, 4, sealedRooms());
+    CHECK(playGame(longGame, shortCircuit) == playGame(longGame), "sealed board with a long game: expected the full game");
+
+    // Walls the tanks can shoot through (the edge columns are neighbours across the wrap)
+    std::string thin = writeBoard("short_thin.txt", 60, 4, {
+        "####################",
+        "#1   #######      2#",
+        "#    #######       #",
+        "####################",
+    });
+    CHECK(playGame(thin, shortCircuit) == playGame(thin), "thin walls: expected the full game");
+
+    for (const char* input : {"inputs/input_a.txt", "inputs/input_b.txt", "inputs/input_c.txt"}) {
+        std::string file = repoFile(input);
+        CHECK(playGame(file, shortCircuit) == playGame(file), input << ": expected the full game");
+    }
+}
@@ -0,0 +1,105 @@
+#pragma once
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "GameOptions.h"
+#include "TankAlgorithmFactory.h"
+
+/**
+ * @brief Number of failed checks so far; the test binary exits non-zero if any.
+ */
+inline int testFailures = 0;
+
+/**
+ * @brief Records a failure (with its location and a description) when the condition is false.
+ */
+#define CHECK(condition, what)                                                                  \
+    do {                                                                                        \
+        if (!(condition)) {                                                                     \
+            ++testFailures;                                                                     \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " << #condition        \
+                      << " (" << what << ")\n";                                                 \
+        }                                                                                       \
+    } while (0)
+
+/**
+ * @brief Optional interfaces of the built-in algorithms that a game can be made not to see
+ *        (bit flags), so that a test can compare a feature against the plain getAction path.
+ */
+enum HiddenInterface : unsigned {
+    HideNothing   = 0,
+    HideStateHash = 1 << 0, ///< StateHashable: turns cycle detection off
+    HidePlans     = 1 << 1  ///< ActionPlanner: every action comes from getAction
+};
+
+/**
+ * @brief Returns the built-in algorithm factory, its algorithms wrapped so that the given
+ *        interfaces are hidden (HideNothing returns the built-in factory itself).
+ */
+std::unique_ptr<TankAlgorithmFactory> makeAlgorithmFactory(unsigned hidden = HideNothing);
+
+/**
+ * @brief Returns the path of a file of the repository (tests run in a scratch directory).
+ */
+std::string repoFile(const std::string& relative);
+
+/**
+ * @brief Writes a board file with the given map rows in the working directory.
+ * @return The file name.
+ */
+std::string writeBoard(const std::string& name, int maxSteps, int numShells, const std::vector<std::string>& map);
+
+/**
+ * @brief Writes a random board (walls, mines and tanksPerPlayer tanks each) with a fixed seed.
+ * @return The file name.
+ */
+std::string writeRandomBoard(const std::string& name, size_t rows, size_t cols, size_t tanksPerPlayer, unsigned seed);
+
+/**
+ * @brief Plays a whole game with the built-in players and returns its output file.
+ */
+std::string playGame(const std::string& boardFile, const GameOptions& options = {}, unsigned hidden = HideNothing);
+
+/**
+ * @brief Plays two random boards (12x16 and 40x60), the sample inputs and moreBoards with
+ *        default options and the given interfaces hidden, then with each variant, and checks
+ *        that every variant writes the same output file.
+ */
+void expectSameOutputs(const std::vector<GameOptions>& variants, unsigned referenceHidden = HideNothing,
+                       const std::vector<std::string>& moreBoards = {});
+
+// One entry point per test, run by name from main (see tests/main.cpp)
+
+/** @brief Every compiled shell advancement kernel against a reference on random shells. */
+void testShellKernels();
+
+/** @brief Every compiled view classification kernel against a reference on all byte values. */
+void testViewKernels();
+
+/** @brief A board that cycles gives the same output with and without fast-forwarding. */
+void testCycleDetection();
+
+/** @brief Short-circuited games write the result line of the full game, and only qualifying games are short-circuited. */
+void testShortCircuit();
+
+/** @brief Games give the same output with their actions collected on several threads. */
+void testDecisionThreads();
+
+/** @brief Games give the same output with the algorithms' plans as with one getAction per turn. */
+void testActionPlans();
+
+/** @brief Every view the players get lists the tanks and shells its getObjectAt shows. */
+void testEntityLists();
+
+/** @brief Games give the same output with battle infos listing only the changed cells. */
+void testDeltaInfo();
+
+/** @brief Games give the same output with the tanks classifying shared board snapshots lazily. */
+void testLazyInfo();
+
+/** @brief With a view radius, the tanks see only their windows and get no deltas. */
+void testViewWindow();
+
+/** @brief A windowed chasing tank does not plan a path through the cells it cannot see. */
+void testWindowPaths();
@@ -0,0 +1,96 @@
+#include "Test.h"
+#include "ViewKernels.h"
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief The classification as MyBattleInfo did it before the kernels, one switch per character.
+ */
+ObjectType referenceType(char c, int playerIndex) {
+    switch (c) {
+        case '1': return playerIndex == 1 ? ObjectType::AllyTank : ObjectType::EnemyTank;
+        case '2': return playerIndex == 2 ? ObjectType::AllyTank : ObjectType::EnemyTank;
+        case '*': return ObjectType::Shell;
+        case '#': return ObjectType::Wall;
+        case '@': return ObjectType::Mine;
+        case '%': return ObjectType::AllyTank;
+        case '?': return ObjectType::Unknown;
+        default: return ObjectType::Empty;
+    }
+}
+
+/**
+ * @brief Classifies a row with one kernel and compares the types and the three masks with
+ *        the reference. The outputs start out dirty, and a guard past the row must stay put.
+ */
+void checkRow(const ViewKernelVariant& kernel, const std::string& chars, int playerIndex, const std::string& what) {
+    size_t count = chars.size();
+    size_t words = (count + 63) / 64;
+    std::vector<ObjectType> types(count + 1, ObjectType::Wall);
+    std::vector<uint64_t> shells(words + 1, ~uint64_t{0});
+    std::vector<uint64_t> self(words + 1, ~uint64_t{0});
+    std::vector<uint64_t> enemies(words + 1, ~uint64_t{0});
+    kernel.classify(chars.data(), count, playerIndex, types.data(), {shells.data(), self.data(), enemies.data()});
+
+    std::vector<uint64_t> expectedShells(words + 1, 0), expectedSelf(words + 1, 0), expectedEnemies(words + 1, 0);
+    expectedShells[words] = expectedSelf[words] = expectedEnemies[words] = ~uint64_t{0};
+    bool typesMatch = types[count] == ObjectType::Wall;
+    for (size_t i = 0; i < count; ++i) {
+        ObjectType type = referenceType(chars[i], playerIndex);
+        typesMatch = typesMatch && types[i] == type;
+        uint64_t bit = uint64_t{1} << (i & 63);
+        if (type == ObjectType::Shell) expectedShells[i >> 6] |= bit;
+        if (type == ObjectType::EnemyTank) expectedEnemies[i >> 6] |= bit;
+        if (chars[i] == '%') expectedSelf[i >> 6] |= bit;
+    }
+    CHECK(typesMatch, kernel.name << " kernel types, " << what << ", player " << playerIndex);
+    CHECK(shells == expectedShells && self == expectedSelf && enemies == expectedEnemies,
+          kernel.name << " kernel masks, " << what << ", player " << playerIndex);
+}
+
+} // namespace
+
+/**
+ * @brief Runs every kernel the CPU supports over all 256 byte values, rotated so that each
+ *        lands in every lane of a vector, and over rows of every length up to 100 characters
+ *        (mostly view characters), so that every vector tail shows up. Kernels the CPU lacks
+ *        are reported as skipped.
+ */
+void testViewKernels() {
+    const std::string alphabet = " #%&*12?@";
+    std::mt19937 random(2024);
+
+    for (const ViewKernelVariant& kernel : getViewKernels()) {
+        if (!kernel.supported) {
+            std::cout << "  skipped kernel " << kernel.name << " (not supported by this CPU)\n";
+            continue;
+        }
+        for (int playerIndex = 1; playerIndex <= 2; ++playerIndex) {
+            for (size_t rotation = 0; rotation < 64; ++rotation) {
+                std::string bytes(256, '\0');
+                for (size_t i = 0; i < bytes.size(); ++i) bytes[i] = static_cast<char>((i + rotation) & 255);
+                checkRow(kernel, bytes, playerIndex, "all bytes rotated by " + std::to_string(rotation));
+            }
+            for (size_t count = 0; count <= 100; ++count) {
+                std::string row(count, ' ');
+                for (char& c : row) {
+                    c = random() % 4 == 0 ? static_cast<char>(random() & 255) : alphabet[random() % alphabet.size()];
+                }
+                checkRow(kernel, row, playerIndex, std::to_string(count) + " characters");
+            }
+        }
+    }
+
+    // The dispatcher must run one of the variants checked above
+    std::string row(77, ' ');
+    for (char& c : row) c = alphabet[random() % alphabet.size()];
+    std::vector<ObjectType> types(row.size());
+    uint64_t shells[2], self[2], enemies[2];
+    classifyViewRow(row.data(), row.size(), 2, types.data(), {shells, self, enemies});
+    bool typesMatch = true;
+    for (size_t i = 0; i < row.size(); ++i) typesMatch = typesMatch && types[i] == referenceType(row[i], 2);
+    CHECK(typesMatch, "classifyViewRow");
+}
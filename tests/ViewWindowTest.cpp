@@ -0,0 +1,114 @@
+#include "Test.h"
+#include "GameManager.h"
+#include "MyBattleInfo.h"
+#include "MyPlayerFactory.h"
+#include "MySatelliteView.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Checks every battle info request against the window, then hands the view on to the
+ *        built-in player so that the game goes on as usual.
+ */
+class WindowCheckingPlayer : public Player {
+    std::unique_ptr<Player> player;
+    int playerIndex;
+    size_t rows;
+    size_t cols;
+    size_t numShells;
+    size_t radius;
+    size_t& requests;
+
+    /**
+     * @brief Checks whether a coordinate is within radius of the center on a wrapped axis.
+     */
+    bool withinAxis(size_t a, size_t center, size_t length) const {
+        size_t distance = a >= center ? a - center : center - a;
+        return std::min(distance, length - distance) <= radius;
+    }
+
+public:
+    WindowCheckingPlayer(int playerIndex, size_t x, size_t y, size_t maxSteps, size_t numShells, size_t radius,
+                         size_t& requests)
+        : Player(playerIndex, x, y, maxSteps, numShells),
+          player(MyPlayerFactory().create(playerIndex, x, y, maxSteps, numShells)), playerIndex(playerIndex),
+          rows(y), cols(x), numShells(numShells), radius(radius), requests(requests) {}
+
+    void updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& view) override {
+        auto& window = dynamic_cast<MySatelliteView&>(view);
+        std::pair<int, int> center = {-1, -1};
+        for (size_t y = 0; y < rows; ++y) {
+            for (size_t x = 0; x < cols; ++x) {
+                if (window.getObjectAt(x, y) == '%') center = {static_cast<int>(x), static_cast<int>(y)};
+            }
+        }
+        CHECK(center.first >= 0, "the requesting tank shows inside its window");
+
+        MyBattleInfo info(window, playerIndex, rows, cols, static_cast<int>(numShells));
+        bool charsMatch = true;
+        bool typesMatch = true;
+        for (size_t y = 0; y < rows; ++y) {
+            for (size_t x = 0; x < cols; ++x) {
+                bool shown = withinAxis(x, center.first, cols) && withinAxis(y, center.second, rows);
+                charsMatch = charsMatch && (window.getObjectAt(x, y) == '?') != shown;
+                typesMatch = typesMatch && (info.getGrid()[y][x] == ObjectType::Unknown) != shown;
+            }
+        }
+        CHECK(charsMatch, "radius " << radius << ": only the cells outside the window read as '?'");
+        CHECK(typesMatch, "radius " << radius << ": only the cells outside the window read as Unknown");
+
+        // The first request has the journal from version 1 on, so only the window refuses a delta
+        std::vector<std::pair<int, int>> changed;
+        window.setKnownVersion(1);
+        CHECK(!window.listChangedCells(changed), "radius " << radius << ": a windowed view lists changed cells");
+        if (requests == 0) {
+            window.setWindow(ViewWindow{});
+            CHECK(window.listChangedCells(changed), "an unlimited view lists the changed cells");
+            window.setWindow(ViewWindow{center, radius});
+        }
+        window.setKnownVersion(0);
+        ++requests;
+
+        player->updateTankWithBattleInfo(tank, view);
+    }
+};
+
+/**
+ * @brief Creates WindowCheckingPlayers for the given radius.
+ */
+class WindowCheckingPlayerFactory : public PlayerFactory {
+    size_t radius;
+    size_t& requests;
+
+public:
+    WindowCheckingPlayerFactory(size_t radius, size_t& requests) : radius(radius), requests(requests) {}
+
+    std::unique_ptr<Player> create(int playerIndex, size_t x, size_t y, size_t maxSteps, size_t numShells) const override {
+        return std::make_unique<WindowCheckingPlayer>(playerIndex, x, y, maxSteps, numShells, radius, requests);
+    }
+};
+
+} // namespace
+
+/**
+ * @brief Plays games with --view-radius and checks every view the players get: the cells
+ *        farther than the radius from the requesting tank (wrapping around the edges) read as
+ *        '?' and classify as ObjectType::Unknown, every other cell is shown, and a windowed
+ *        view offers no delta.
+ */
+void testViewWindow() {
+    std::string board = writeRandomBoard("window.txt", 20, 30, 3, 5);
+    for (size_t radius : {1, 3, 8}) {
+        size_t requests = 0;
+        GameOptions options;
+        options.viewRadius = radius;
+        GameManager game(std::make_unique<WindowCheckingPlayerFactory>(radius, requests), makeAlgorithmFactory(), options);
+        if (game.readBoard(board)) game.run();
+        CHECK(requests > 0, "radius " << radius << ": the tanks asked for battle info");
+    }
+}
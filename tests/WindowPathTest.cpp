@@ -0,0 +1,37 @@
+#include "Test.h"
+#include <sstream>
+#include <string>
+
+/**
+ * @brief The chasing tank (player 2) sees its target two cells away behind a wall. The only
+ *        way around leaves its radius-2 window through the corridors above, and outside the
+ *        window it runs into walls, so there is no path to the target. Planning through the
+ *        cells it cannot see would send the tank up the corridor; treating them as blocked,
+ *        it finds no path and stays where it is.
+ */
+void testWindowPaths() {
+    std::string board = writeBoard("window_paths.txt", 60, 0, {
+        "############",
+        "##### # ####",
+        "##### # ####",
+        "##### # ####",
+        "##### # ####",
+        "#####2#1####",
+        "############",
+        "############",
+        "############",
+        "############",
+        "############",
+        "############",
+    });
+    GameOptions options;
+    options.viewRadius = 2;
+    std::istringstream lines(playGame(board, options));
+    size_t turns = 0;
+    for (std::string line; std::getline(lines, line) && line.find(", ") != std::string::npos; ++turns) {
+        // The chasing tank comes first in row-major order
+        std::string chaser = line.substr(0, line.find(", "));
+        CHECK(chaser.find("Move") == std::string::npos, "turn " << turns + 1 << ": the chasing tank moved (" << chaser << ")");
+    }
+    CHECK(turns > 0, "the windowed game was played");
+}
@@ -0,0 +1,54 @@
+#include "Test.h"
+#include <filesystem>
+#include <string>
+
+namespace {
+std::filesystem::path repoRoot; ///< Working directory the tests were started from
+}
+
+/**
+ * @brief Resolves a path against the directory the tests were started from.
+ */
+std::string repoFile(const std::string& relative) {
+    return (repoRoot / relative).string();
+}
+
+/**
+ * @brief Runs the tests named on the command line (all of them by default) in a scratch
+ *        directory, since games write their output files to the working directory, and
+ *        returns non-zero if a check failed.
+ */
+int main(int argc, char* argv[]) {
+    struct Entry {
+        const char* name;
+        void (*run)();
+    };
+    const Entry tests[] = {
+        {"shell-kernels", testShellKernels},
+        {"view-kernels", testViewKernels},
+        {"cycle-detection", testCycleDetection},
+        {"short-circuit", testShortCircuit},
+        {"decision-threads", testDecisionThreads},
+        {"action-plans", testActionPlans},
+        {"entity-lists", testEntityLists},
+        {"delta-info", testDeltaInfo},
+        {"lazy-info", testLazyInfo},
+        {"view-window", testViewWindow},
+        {"window-paths", testWindowPaths},
+    };
+
+    repoRoot = std::filesystem::current_path();
+    std::filesystem::path scratch = std::filesystem::temp_directory_path() / "tanks_tests";
+    std::filesystem::create_directories(scratch);
+    std::filesystem::current_path(scratch);
+
+    for (const Entry& test : tests) {
+        bool selected = argc == 1;
+        for (int i = 1; i < argc; ++i) selected = selected || test.name == std::string(argv[i]);
+        if (!selected) continue;
+        int failuresBefore = testFailures;
+        test.run();
+        std::cout << (testFailures == failuresBefore ? "PASS " : "FAIL ") << test.name << std::endl;
+    }
+    return testFailures == 0 ? 0 : 1;
+}